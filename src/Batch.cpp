@@ -0,0 +1,200 @@
+#include "Batch.h"
+#include "Console.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <dirent.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sys/stat.h>
+
+BatchRunner::BatchRunner(const MinimizerOptions& run_options, int jobs, ResultCache& result_cache)
+    : options(run_options), num_jobs(jobs), cache(result_cache) {
+}
+
+static bool isDirectory(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+static long long fileSize(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 ? (long long)info.st_size : 0;
+}
+
+// "dir/test1.pla" -> "test1"
+static std::string stem(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    std::string name = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t dot = name.rfind('.');
+    return (dot == std::string::npos || dot == 0) ? name : name.substr(0, dot);
+}
+
+bool BatchRunner::collectInputs(const std::string& source, std::vector<std::string>& files,
+                                std::string& error) {
+    files.clear();
+
+    if (isDirectory(source)) {
+        DIR* dir = opendir(source.c_str());
+        if (!dir) {
+            error = "Cannot read directory " + source;
+            return false;
+        }
+        while (struct dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".pla") == 0) {
+                files.push_back(source + "/" + name);
+            }
+        }
+        closedir(dir);
+        std::sort(files.begin(), files.end());
+        return true;
+    }
+
+    std::ifstream manifest(source);
+    if (!manifest.is_open()) {
+        error = "Cannot open manifest " + source;
+        return false;
+    }
+    std::string line;
+    while (std::getline(manifest, line)) {
+        line = line.substr(0, line.find('#'));
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos) continue;
+        size_t end = line.find_last_not_of(" \t\r");
+        files.push_back(line.substr(begin, end - begin + 1));
+    }
+    return true;
+}
+
+void BatchRunner::runJob(const MinimizerOptions& options, ResultCache& cache, Job& job) {
+    std::ofstream log(job.log);
+    setConsole(&log);
+    try {
+        job.result = minimizePla(options, job.input, job.output, cache);
+    } catch (const std::exception& e) {
+        job.result = MinimizeResult();
+        job.result.error = std::string("Exception: ") + e.what();
+    }
+    if (!job.result.ok) {
+        log << "\n[Error] " << job.result.error << std::endl;
+    }
+    setConsole(nullptr);
+}
+
+bool BatchRunner::writeSummary(const std::vector<Job>& jobs, const std::string& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) return false;
+
+    file << "file\tstatus\tinputs\tterms\tliterals\toptimal\tseconds\terror\n";
+    for (const auto& job : jobs) {
+        const MinimizeResult& r = job.result;
+        file << job.input << "\t" << (r.ok ? "ok" : "failed") << "\t" << r.num_inputs << "\t"
+             << r.product_terms << "\t" << r.literals << "\t" << (r.proven_optimal ? "yes" : "no")
+             << "\t" << std::fixed << std::setprecision(6) << r.seconds << "\t" << r.error << "\n";
+    }
+    return true;
+}
+
+int BatchRunner::run(const std::vector<std::string>& inputs, const std::string& output_dir) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (mkdir(output_dir.c_str(), 0777) != 0 && errno != EEXIST) {
+        std::cerr << "[Error] Cannot create output directory " << output_dir << std::endl;
+        return inputs.size();
+    }
+
+    // Outputs are named after the inputs; a repeated name would overwrite
+    std::vector<Job> jobs(inputs.size());
+    std::map<std::string, int> name_count;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        std::string name = stem(inputs[i]);
+        jobs[i].input = inputs[i];
+        jobs[i].output = output_dir + "/" + name + ".pla";
+        jobs[i].log = output_dir + "/" + name + ".log";
+        jobs[i].size = fileSize(inputs[i]);
+        if (name_count[name]++ > 0) {
+            jobs[i].result.error = "Duplicate file name " + name + " in the batch";
+        }
+    }
+
+    // Largest first: the pool takes tasks in submission order
+    std::vector<size_t> order;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        if (jobs[i].result.error.empty()) order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&jobs](size_t a, size_t b) {
+        return jobs[a].size > jobs[b].size;
+    });
+
+    ThreadPool pool(num_jobs);
+    LOG(SUMMARY) << "====================================" << std::endl;
+    LOG(SUMMARY) << "  Batch Minimization" << std::endl;
+    LOG(SUMMARY) << "====================================" << std::endl;
+    LOG(SUMMARY) << "Input  PLAs: " << inputs.size() << std::endl;
+    LOG(SUMMARY) << "Output dir:  " << output_dir << std::endl;
+    LOG(SUMMARY) << "Workers:     " << pool.size() << std::endl << std::endl;
+
+    // Runs on the worker threads, after runJob has restored their console
+    std::mutex print_mutex;
+    int finished = 0;
+    auto report = [&](const Job& job) {
+        std::lock_guard<std::mutex> lock(print_mutex);
+        finished++;
+        LOG(SUMMARY) << (job.result.ok ? "  ✓ [" : "  ✗ [") << finished << "/" << jobs.size() << "] "
+                     << job.input << ": ";
+        if (job.result.ok) {
+            LOG(SUMMARY) << job.result.product_terms << " terms, " << job.result.literals
+                         << " literals, " << std::fixed << std::setprecision(3)
+                         << job.result.seconds << " s" << std::endl;
+        } else {
+            LOG(SUMMARY) << job.result.error << std::endl;
+        }
+    };
+
+    for (auto& job : jobs) {
+        if (!job.result.error.empty()) report(job);
+    }
+
+    std::vector<std::future<void>> pending;
+    for (size_t i : order) {
+        Job* job = &jobs[i];
+        const MinimizerOptions* run_options = &options;
+        ResultCache* shared_cache = &cache;
+        pending.push_back(pool.submit([job, run_options, shared_cache, &report]() {
+            runJob(*run_options, *shared_cache, *job);
+            report(*job);
+        }));
+    }
+    for (auto& p : pending) {
+        p.get();
+    }
+
+    // Summary in input order
+    int failed = 0;
+    double file_seconds = 0;
+    for (const auto& job : jobs) {
+        if (!job.result.ok) failed++;
+        file_seconds += job.result.seconds;
+    }
+    double wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::string summary_path = output_dir + "/summary.tsv";
+    LOG(SUMMARY) << "\n[Summary] " << (jobs.size() - failed) << " succeeded, " << failed << " failed"
+                 << std::endl;
+    LOG(SUMMARY) << "  ✓ Wall time: " << std::fixed << std::setprecision(3) << wall_seconds
+                 << " s (" << file_seconds << " s over all files)" << std::endl;
+    if (cache.isEnabled()) {
+        cache.printCounters();
+    }
+    if (writeSummary(jobs, summary_path)) {
+        LOG(SUMMARY) << "  ✓ Per-file results: " << summary_path << std::endl;
+    } else {
+        std::cerr << "[Error] Cannot write " << summary_path << std::endl;
+    }
+    return failed;
+}
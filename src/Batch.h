@@ -0,0 +1,45 @@
+#pragma once
+#include "Minimizer.h"
+#include "ResultCache.h"
+#include <string>
+#include <vector>
+
+// Batch mode: minimize many PLA files in one process
+// The inputs come from a manifest (one PLA path per line, '#' comments) or
+// from every .pla file of a directory. The files are minimized concurrently
+// on a ThreadPool, largest first, so that a big file does not start last and
+// hold up the whole batch. For every input <name>.pla the output directory
+// gets:
+//   <name>.pla   the minimized PLA
+//   <name>.log   the console output of its run
+// plus one summary.tsv line (terms, literals, time). A file that fails
+// (unreadable input, exception) is reported there and the others go on.
+class BatchRunner {
+private:
+    struct Job {
+        std::string input;
+        std::string output;
+        std::string log;
+        long long size;                    // Input size in bytes, for scheduling
+        MinimizeResult result;
+    };
+
+    MinimizerOptions options;
+    int num_jobs;                          // Worker threads (0 = all cores)
+    ResultCache& cache;
+
+    // Minimize one file with its console output going to its log
+    static void runJob(const MinimizerOptions& options, ResultCache& cache, Job& job);
+
+    static bool writeSummary(const std::vector<Job>& jobs, const std::string& path);
+
+public:
+    BatchRunner(const MinimizerOptions& run_options, int jobs, ResultCache& result_cache);
+
+    // Expand a manifest file or a directory into the list of PLA files
+    static bool collectInputs(const std::string& source, std::vector<std::string>& files,
+                              std::string& error);
+
+    // Minimize every input; returns the number of files that failed
+    int run(const std::vector<std::string>& inputs, const std::string& output_dir);
+};
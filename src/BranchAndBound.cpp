@@ -0,0 +1,223 @@
+#include "BranchAndBound.h"
+#include <algorithm>
+#include <climits>
+#include <map>
+
+// Constructor: renumber PIs and minterms densely and build coverage bitsets
+BranchAndBoundCover::BranchAndBoundCover(const std::vector<PetrickTerm>& clauses,
+                                         const std::vector<int>& literals)
+    : num_minterms(clauses.size()), best_cost(LLONG_MAX), lower_bound(0),
+      nodes(0), stopped(false) {
+
+    num_words = (num_minterms + 63) / 64;
+
+    std::map<int, int> local_of_pi;
+    for (const auto& clause : clauses) {
+        for (int pi : clause) {
+            if (local_of_pi.find(pi) == local_of_pi.end()) {
+                local_of_pi[pi] = pi_ids.size();
+                pi_ids.push_back(pi);
+                pi_literals.push_back(literals[pi]);
+            }
+        }
+    }
+
+    pi_cover.assign(pi_ids.size(), std::vector<uint64_t>(num_words, 0));
+    minterm_pis.resize(num_minterms);
+
+    for (size_t j = 0; j < num_minterms; j++) {
+        for (int pi : clauses[j]) {
+            int local = local_of_pi[pi];
+            pi_cover[local][j / 64] |= uint64_t(1) << (j % 64);
+            minterm_pis[j].push_back(local);
+        }
+    }
+
+    // Any cover has fewer literals than all PIs together, so this scale
+    // makes the PI count dominate the literal count
+    literal_scale = 1;
+    for (int lits : pi_literals) {
+        literal_scale += lits;
+    }
+
+    minterm_order.resize(num_minterms);
+    for (size_t j = 0; j < num_minterms; j++) {
+        minterm_order[j] = j;
+    }
+    std::stable_sort(minterm_order.begin(), minterm_order.end(), [this](int a, int b) {
+        return minterm_pis[a].size() < minterm_pis[b].size();
+    });
+
+    forbidden.assign(pi_ids.size(), 0);
+}
+
+int BranchAndBoundCover::computeLowerBound() const {
+    std::vector<uint64_t> all(num_words, 0);
+    for (size_t j = 0; j < num_minterms; j++) {
+        all[j / 64] |= uint64_t(1) << (j % 64);
+    }
+    return disjointLowerBound(all);
+}
+
+void BranchAndBoundCover::setIncumbent(const PetrickTerm& cover) {
+    best_cover.clear();
+    int literals = 0;
+
+    for (size_t p = 0; p < pi_ids.size(); p++) {
+        if (cover.count(pi_ids[p])) {
+            best_cover.push_back(p);
+            literals += pi_literals[p];
+        }
+    }
+
+    best_cost = cost(best_cover.size(), literals);
+}
+
+bool BranchAndBoundCover::search(const CoverBudget& budget) {
+    std::vector<uint64_t> uncovered(num_words, 0);
+    for (size_t j = 0; j < num_minterms; j++) {
+        uncovered[j / 64] |= uint64_t(1) << (j % 64);
+    }
+
+    lower_bound = disjointLowerBound(uncovered);
+    stopped = false;
+    chosen.clear();
+
+    branch(uncovered, 0, 0, budget);
+
+    if (!stopped) {
+        // The search space is exhausted, so the incumbent is optimal
+        lower_bound = best_cover.size();
+    }
+    return !stopped;
+}
+
+void BranchAndBoundCover::branch(const std::vector<uint64_t>& uncovered, int count,
+                                 int literals, const CoverBudget& budget) {
+    if (stopped) {
+        return;
+    }
+
+    // Check the clock only now and then; it is much slower than a node
+    if ((++nodes & 1023) == 0 && budget.timeExpired()) {
+        stopped = true;
+        return;
+    }
+
+    // Pick the uncovered minterm with the fewest allowed PIs
+    int branch_minterm = -1;
+    size_t fewest = SIZE_MAX;
+
+    for (size_t w = 0; w < num_words; w++) {
+        uint64_t bits = uncovered[w];
+        while (bits) {
+            int j = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            size_t allowed = 0;
+            for (int p : minterm_pis[j]) {
+                if (!forbidden[p]) allowed++;
+            }
+            if (allowed < fewest) {
+                fewest = allowed;
+                branch_minterm = j;
+            }
+        }
+    }
+
+    if (branch_minterm < 0) {
+        // Everything is covered: new incumbent if strictly cheaper
+        long long c = cost(count, literals);
+        if (c < best_cost) {
+            best_cost = c;
+            best_cover = chosen;
+        }
+        return;
+    }
+
+    if (fewest == 0) {
+        return;  // Some minterm can no longer be covered on this branch
+    }
+
+    // Bound: even the cheapest completion cannot beat the incumbent
+    int lb = disjointLowerBound(uncovered);
+    if (cost(count + lb, literals) >= best_cost) {
+        return;
+    }
+
+    // Try PIs covering most of what is left first
+    std::vector<std::pair<int, int>> candidates;  // (-gain, PI)
+    for (int p : minterm_pis[branch_minterm]) {
+        if (forbidden[p]) continue;
+        int gain = 0;
+        for (size_t w = 0; w < num_words; w++) {
+            gain += __builtin_popcountll(pi_cover[p][w] & uncovered[w]);
+        }
+        candidates.push_back(std::make_pair(-gain, p));
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [this](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                  if (a.first != b.first) return a.first < b.first;
+                  return pi_literals[a.second] < pi_literals[b.second];
+              });
+
+    // After a PI's branch is done, every cover containing it has been seen,
+    // so later siblings exclude it
+    std::vector<int> excluded;
+    std::vector<uint64_t> next(num_words);
+
+    for (const auto& candidate : candidates) {
+        int p = candidate.second;
+        for (size_t w = 0; w < num_words; w++) {
+            next[w] = uncovered[w] & ~pi_cover[p][w];
+        }
+
+        chosen.push_back(p);
+        branch(next, count + 1, literals + pi_literals[p], budget);
+        chosen.pop_back();
+
+        if (stopped) break;
+
+        forbidden[p] = 1;
+        excluded.push_back(p);
+    }
+
+    for (int p : excluded) {
+        forbidden[p] = 0;
+    }
+}
+
+int BranchAndBoundCover::disjointLowerBound(const std::vector<uint64_t>& uncovered) const {
+    // Minterms whose clauses share no PI each need a different PI
+    std::vector<char> used(pi_ids.size(), 0);
+    int bound = 0;
+
+    for (int j : minterm_order) {
+        if (!(uncovered[j / 64] >> (j % 64) & 1)) continue;
+
+        bool disjoint = true;
+        for (int p : minterm_pis[j]) {
+            if (used[p]) {
+                disjoint = false;
+                break;
+            }
+        }
+
+        if (disjoint) {
+            bound++;
+            for (int p : minterm_pis[j]) {
+                used[p] = 1;
+            }
+        }
+    }
+
+    return bound;
+}
+
+PetrickTerm BranchAndBoundCover::getBestCover() const {
+    PetrickTerm cover;
+    for (int p : best_cover) {
+        cover.insert(pi_ids[p]);
+    }
+    return cover;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "CoverBudget.h"
+#include "Petrick.h"
+#include <cstdint>
+#include <vector>
+
+// Anytime branch-and-bound search for a minimum cover
+// Works on the clauses of one chart component (one clause per minterm,
+// listing the PIs that cover it). The cost of a cover is compared first by
+// number of PIs, then by number of literals, like selectMinimalCover().
+//
+// The search starts from an incumbent cover (e.g. a greedy one), only keeps
+// strictly better covers, and can be stopped by a time budget at any point.
+// If it runs to completion, the final incumbent is proven optimal.
+class BranchAndBoundCover {
+private:
+    std::vector<int> pi_ids;                     // Local PI index -> chart PI index
+    std::vector<int> pi_literals;                // Literal count per local PI
+    std::vector<std::vector<uint64_t>> pi_cover; // Bitset of minterms covered per local PI
+    std::vector<std::vector<int>> minterm_pis;   // Local PIs covering each minterm
+    std::vector<int> minterm_order;              // Minterms by clause size, for the lower bound
+    size_t num_minterms;
+    size_t num_words;
+    long long literal_scale;                     // Cost = PIs * literal_scale + literals
+
+    std::vector<int> best_cover;                 // Local PIs of the incumbent
+    long long best_cost;
+    int lower_bound;                             // Proven lower bound on PIs
+    long long nodes;
+    bool stopped;
+
+    std::vector<int> chosen;                     // Current partial cover
+    std::vector<char> forbidden;                 // PIs excluded on the current branch
+
+    // Depth-first search below the current partial cover
+    void branch(const std::vector<uint64_t>& uncovered, int count, int literals,
+                const CoverBudget& budget);
+
+    // Lower bound on PIs needed: minterms whose clauses are pairwise disjoint
+    int disjointLowerBound(const std::vector<uint64_t>& uncovered) const;
+
+    long long cost(int count, int literals) const { return count * literal_scale + literals; }
+
+public:
+    // clauses: one set of chart PI indices per minterm
+    // literals: literal count of every chart PI
+    BranchAndBoundCover(const std::vector<PetrickTerm>& clauses,
+                        const std::vector<int>& literals);
+
+    // Lower bound on PIs for the whole problem, without searching
+    int computeLowerBound() const;
+
+    // Use a known valid cover as the starting incumbent
+    void setIncumbent(const PetrickTerm& cover);
+
+    // Improve the incumbent until the search completes or the budget expires
+    // Returns true if the search completed (incumbent proven optimal)
+    bool search(const CoverBudget& budget);
+
+    // Results
+    PetrickTerm getBestCover() const;
+    int getLowerBound() const { return lower_bound; }
+    long long getNodesExplored() const { return nodes; }
+};
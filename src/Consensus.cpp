@@ -0,0 +1,114 @@
+#include "Consensus.h"
+#include "Console.h"
+#include <algorithm>
+#include <iostream>
+
+ConsensusPrimeGenerator::ConsensusPrimeGenerator(int num_variables)
+    : num_vars(num_variables), input_cubes(0), pairs_checked(0), consensus_added(0) {
+}
+
+void ConsensusPrimeGenerator::findPrimeImplicants(const std::vector<ProductTerm>& terms) {
+    prime_implicants.clear();
+    pairs_checked = 0;
+    consensus_added = 0;
+
+    std::vector<Cube> cubes;
+    for (const auto& term : terms) {
+        cubes.push_back(Cube::fromString(term.cube));
+    }
+    input_cubes = cubes.size();
+
+    // Single-cube containment on the input, largest cubes first
+    std::stable_sort(cubes.begin(), cubes.end(), [](const Cube& a, const Cube& b) {
+        return a.literalCount() < b.literalCount();
+    });
+    std::vector<Cube> kept;
+    for (const auto& c : cubes) {
+        bool contained = false;
+        for (const auto& k : kept) {
+            if (k.contains(c)) {
+                contained = true;
+                break;
+            }
+        }
+        if (!contained) kept.push_back(c);
+    }
+    cubes.swap(kept);
+
+    // Every cube is paired with every cube before it when it is processed,
+    // so each pair is tried once; cubes dropped by containment are skipped
+    std::vector<char> alive(cubes.size(), 1);
+
+    for (size_t i = 0; i < cubes.size(); i++) {
+        for (size_t j = 0; j < i && alive[i]; j++) {
+            if (!alive[j]) continue;
+            pairs_checked++;
+            if (cubes[i].distance(cubes[j]) != 1) continue;
+
+            Cube c = cubes[i].consensus(cubes[j]);
+
+            bool contained = false;
+            for (size_t k = 0; k < cubes.size(); k++) {
+                if (alive[k] && cubes[k].contains(c)) {
+                    contained = true;
+                    break;
+                }
+            }
+            if (contained) continue;
+
+            // New cube: drop everything it contains (possibly cubes[i] itself)
+            for (size_t k = 0; k < cubes.size(); k++) {
+                if (alive[k] && c.contains(cubes[k])) alive[k] = 0;
+            }
+            cubes.push_back(c);
+            alive.push_back(1);
+            consensus_added++;
+        }
+    }
+
+    // The covering stage works on minterms: list the points of each prime
+    for (size_t i = 0; i < cubes.size(); i++) {
+        if (!alive[i]) continue;
+        std::string value = cubes[i].toString();
+
+        std::vector<int> free_bits;
+        int base = 0;
+        for (int v = 0; v < num_vars; v++) {
+            int bit = num_vars - 1 - v;  // The first character is the MSB
+            if (value[v] == '1') base |= 1 << bit;
+            else if (value[v] == '-') free_bits.push_back(bit);
+        }
+
+        std::set<int> minterms;
+        for (int mask = 0; mask < (1 << free_bits.size()); mask++) {
+            int m = base;
+            for (size_t b = 0; b < free_bits.size(); b++) {
+                if (mask & (1 << b)) m |= 1 << free_bits[b];
+            }
+            minterms.insert(m);
+        }
+        prime_implicants.push_back(Implicant(value, minterms));
+    }
+
+    // QuineMcCluskey's column order: fewer '-' first, then fewer 1's, then
+    // by the minterms covered
+    std::sort(prime_implicants.begin(), prime_implicants.end(),
+              [](const Implicant& a, const Implicant& b) {
+        int dash_a = std::count(a.value.begin(), a.value.end(), '-');
+        int dash_b = std::count(b.value.begin(), b.value.end(), '-');
+        if (dash_a != dash_b) return dash_a < dash_b;
+        int ones_a = std::count(a.value.begin(), a.value.end(), '1');
+        int ones_b = std::count(b.value.begin(), b.value.end(), '1');
+        if (ones_a != ones_b) return ones_a < ones_b;
+        return a.minterms < b.minterms;
+    });
+}
+
+void ConsensusPrimeGenerator::printSummary() const {
+    LOG(SUMMARY) << "  ✓ Input cubes (on + dc): " << input_cubes << std::endl;
+    LOG(SUMMARY) << "  ✓ Cube pairs checked: " << pairs_checked
+                 << ", consensus cubes added: " << consensus_added << std::endl;
+    for (size_t i = 0; i < prime_implicants.size(); i++) {
+        LOG(DETAILED) << "   PI" << (i + 1) << ": " << prime_implicants[i].value << std::endl;
+    }
+}
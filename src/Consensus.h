@@ -0,0 +1,39 @@
+#pragma once
+#include "Cube.h"
+#include "PlaParser.h"
+#include "QuineMcCluskey.h"
+#include <vector>
+
+// Exact prime implicant generation by iterated consensus
+// Works on the on-set and don't-care cubes of the PLA file instead of their
+// minterms, so the work follows the number of cubes, not 2^n.
+//
+// Two cubes at distance 1 (conflicting in exactly one variable) have a
+// consensus: their intersection with that variable freed, e.g.
+//   1-0 and 0-0  ->  --0
+// Starting from the input cubes, every new consensus that no cube contains
+// is added and the cubes it contains are dropped (single-cube containment).
+// When no pair yields anything new, the cubes left are exactly the prime
+// implicants of on + dc - the same set QuineMcCluskey finds.
+class ConsensusPrimeGenerator {
+private:
+    int num_vars;
+    std::vector<Implicant> prime_implicants;
+
+    // Statistics for printSummary
+    int input_cubes;
+    long long pairs_checked;
+    long long consensus_added;
+
+public:
+    explicit ConsensusPrimeGenerator(int num_variables);
+
+    // Find all prime implicants of the on-set ("1") and don't-care ("-") cubes
+    void findPrimeImplicants(const std::vector<ProductTerm>& terms);
+
+    // Primes ordered like QuineMcCluskey's columns: fewest '-' first, then
+    // by number of 1's. Each one lists its minterms for the covering stage.
+    const std::vector<Implicant>& getPrimeImplicants() const { return prime_implicants; }
+
+    void printSummary() const;
+};
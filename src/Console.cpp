@@ -0,0 +1,41 @@
+#include "Console.h"
+#include <atomic>
+#include <iostream>
+
+static thread_local std::ostream* thread_console = nullptr;
+
+// -1: the thread follows the process's level
+static thread_local int thread_level = -1;
+static std::atomic<int> process_level(int(LogLevel::DETAILED));
+
+std::ostream& console() {
+    return thread_console ? *thread_console : std::cout;
+}
+
+void setConsole(std::ostream* stream) {
+    thread_console = stream;
+}
+
+ScopedConsole::ScopedConsole(std::ostream* stream) : previous(thread_console) {
+    thread_console = stream;
+}
+
+ScopedConsole::~ScopedConsole() {
+    thread_console = previous;
+}
+
+LogLevel logLevel() {
+    return LogLevel(thread_level >= 0 ? thread_level : process_level.load(std::memory_order_relaxed));
+}
+
+void setLogLevel(LogLevel level) {
+    process_level = int(level);
+}
+
+ScopedLogLevel::ScopedLogLevel(LogLevel level) : previous(thread_level) {
+    thread_level = int(level);
+}
+
+ScopedLogLevel::~ScopedLogLevel() {
+    thread_level = previous;
+}
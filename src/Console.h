@@ -0,0 +1,66 @@
+#pragma once
+#include <ostream>
+
+// Stream for the console output of the minimization steps
+// It is std::cout unless the calling thread redirected it: batch mode gives
+// every worker thread its own log, so instances running side by side keep
+// their output apart.
+std::ostream& console();
+
+// Redirect the calling thread's console output (nullptr: back to std::cout)
+void setConsole(std::ostream* stream);
+
+// Redirect the calling thread's console output for one scope, then restore
+// whatever it was before
+class ScopedConsole {
+private:
+    std::ostream* previous;
+
+public:
+    explicit ScopedConsole(std::ostream* stream);
+    ~ScopedConsole();
+
+    ScopedConsole(const ScopedConsole&) = delete;
+    ScopedConsole& operator=(const ScopedConsole&) = delete;
+};
+
+// How much of the console output is written
+//   QUIET     nothing (errors still go to std::cerr)
+//   SUMMARY   the steps and their results
+//   DETAILED  also the traces: QM columns, the chart, Petrick's expansion
+enum class LogLevel { QUIET, SUMMARY, DETAILED };
+
+// Level of the calling thread: its own if set, else the process's
+LogLevel logLevel();
+
+// Level of the whole process (default DETAILED)
+void setLogLevel(LogLevel level);
+
+inline bool logEnabled(LogLevel level) {
+    return level <= logLevel();
+}
+
+// Set the calling thread's level for one scope, then restore it
+class ScopedLogLevel {
+private:
+    int previous;
+
+public:
+    explicit ScopedLogLevel(LogLevel level);
+    ~ScopedLogLevel();
+
+    ScopedLogLevel(const ScopedLogLevel&) = delete;
+    ScopedLogLevel& operator=(const ScopedLogLevel&) = delete;
+};
+
+// Turns a whole "LOG(level) << ..." chain into one void expression
+struct LogVoidify {
+    void operator&(std::ostream&) {}
+};
+
+// LOG(SUMMARY) << "text" << value << std::endl;
+// The operands are not evaluated or formatted when the level is disabled.
+// Functions that only trace check logEnabled(LogLevel::DETAILED) once at
+// the top and then write to console() directly.
+#define LOG(level) \
+    !logEnabled(LogLevel::level) ? (void)0 : LogVoidify() & console()
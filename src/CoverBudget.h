@@ -0,0 +1,36 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+// Time and memory budget for the covering stage
+// A limit of 0 means "no limit". When a limit is hit, the covering stage
+// stops and returns the best valid cover found so far.
+struct CoverBudget {
+    double time_limit_seconds;   // Wall-clock limit for the covering stage
+    size_t memory_limit_mb;      // Limit on the estimated size of a Petrick SOP
+    std::chrono::steady_clock::time_point start;
+
+    CoverBudget() : time_limit_seconds(0), memory_limit_mb(0),
+                    start(std::chrono::steady_clock::now()) {}
+
+    // Is any limit set?
+    bool isLimited() const { return time_limit_seconds > 0 || memory_limit_mb > 0; }
+
+    // Start the clock
+    void begin() { start = std::chrono::steady_clock::now(); }
+
+    // Seconds since begin()
+    double elapsedSeconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Has the time limit passed?
+    bool timeExpired() const {
+        return time_limit_seconds > 0 && elapsedSeconds() >= time_limit_seconds;
+    }
+
+    // Would a structure of this many bytes exceed the memory limit?
+    bool exceedsMemory(size_t bytes) const {
+        return memory_limit_mb > 0 && bytes > memory_limit_mb * 1024 * 1024;
+    }
+};
@@ -0,0 +1,198 @@
+#include "CoverEnumerator.h"
+#include "BranchAndBound.h"
+#include "GreedyCover.h"
+#include <algorithm>
+#include <climits>
+#include <map>
+
+// Constructor: take the Essential PIs, find the minimum cover size of the
+// rest, and queue the empty partial cover
+CoverEnumerator::CoverEnumerator(const std::vector<Implicant>& pis,
+                                 const std::vector<int>& minterms,
+                                 const std::vector<int>& dont_cares)
+    : num_minterms(0), num_words(0), min_literals(0), max_pis(0),
+      next_seq(0), covers_produced(0) {
+
+    chart.build(pis, minterms, dont_cares);
+
+    for (const auto& epi : chart.findEssentialPIs()) {
+        essential_pi_indices.push_back(epi.pi_index);
+    }
+
+    std::vector<int> remaining = chart.getRemainingMinterms(essential_pi_indices);
+
+    // One clause per remaining minterm
+    std::vector<PetrickTerm> clauses;
+    for (int m : remaining) {
+        std::vector<int> covering = chart.getPIsCovering(m);
+        clauses.push_back(PetrickTerm(covering.begin(), covering.end()));
+    }
+
+    std::vector<int> literals;
+    for (const auto& pi : pis) {
+        literals.push_back(pi.value.size() - std::count(pi.value.begin(), pi.value.end(), '-'));
+    }
+
+    // Renumber the PIs that appear in the clauses and build bitsets
+    num_minterms = clauses.size();
+    num_words = (num_minterms + 63) / 64;
+    minterm_pis.resize(num_minterms);
+    std::map<int, int> local_of_pi;
+
+    for (size_t j = 0; j < num_minterms; j++) {
+        for (int pi : clauses[j]) {
+            auto it = local_of_pi.find(pi);
+            int local;
+            if (it == local_of_pi.end()) {
+                local = pi_ids.size();
+                local_of_pi[pi] = local;
+                pi_ids.push_back(pi);
+                pi_literals.push_back(literals[pi]);
+                pi_cover.push_back(std::vector<uint64_t>(num_words, 0));
+            } else {
+                local = it->second;
+            }
+            pi_cover[local][j / 64] |= uint64_t(1) << (j % 64);
+            minterm_pis[j].push_back(local);
+        }
+    }
+
+    min_literals = pi_literals.empty() ? 0 : *std::min_element(pi_literals.begin(), pi_literals.end());
+
+    // The bound every enumerated cover must meet
+    if (!clauses.empty()) {
+        BranchAndBoundCover search(clauses, literals);
+        search.setIncumbent(GreedyCoverSolver::coverClauses(clauses, literals));
+        search.search(CoverBudget());
+        max_pis = search.getBestCover().size();
+    }
+
+    Node root;
+    root.literals = 0;
+    root.uncovered.assign(num_words, 0);
+    for (size_t j = 0; j < num_minterms; j++) {
+        root.uncovered[j / 64] |= uint64_t(1) << (j % 64);
+    }
+    push(root);
+}
+
+void CoverEnumerator::push(Node& node) {
+    int lb = disjointLowerBound(node.uncovered);
+
+    // Prune: this branch can no longer end in a minimum cover
+    if ((int)node.chosen.size() + lb > max_pis) {
+        return;
+    }
+
+    // Each missing PI costs at least min_literals, so the estimate never
+    // exceeds the literal count of any completion
+    node.estimate = node.literals + lb * min_literals;
+    node.seq = next_seq++;
+    frontier.push(node);
+}
+
+bool CoverEnumerator::next(std::vector<int>& pi_indices) {
+    std::vector<char> is_forbidden(pi_ids.size(), 0);
+
+    while (!frontier.empty()) {
+        Node node = frontier.top();
+        frontier.pop();
+
+        for (int p : node.forbidden) is_forbidden[p] = 1;
+
+        // Branch on the uncovered minterm with the fewest allowed PIs
+        int branch_minterm = -1;
+        size_t fewest = SIZE_MAX;
+
+        for (size_t w = 0; w < num_words; w++) {
+            uint64_t bits = node.uncovered[w];
+            while (bits) {
+                int j = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+
+                size_t allowed = 0;
+                for (int p : minterm_pis[j]) {
+                    if (!is_forbidden[p]) allowed++;
+                }
+                if (allowed < fewest) {
+                    fewest = allowed;
+                    branch_minterm = j;
+                }
+            }
+        }
+
+        if (branch_minterm < 0) {
+            // Complete: no queued node can lead to a cheaper cover
+            for (int p : node.forbidden) is_forbidden[p] = 0;
+
+            pi_indices = essential_pi_indices;
+            for (int p : node.chosen) {
+                pi_indices.push_back(pi_ids[p]);
+            }
+            std::sort(pi_indices.begin(), pi_indices.end());
+            covers_produced++;
+            return true;
+        }
+
+        // Child i takes the i-th allowed PI and excludes the ones before it
+        std::vector<int> excluded = node.forbidden;
+
+        for (int p : minterm_pis[branch_minterm]) {
+            if (is_forbidden[p]) continue;
+
+            Node child;
+            child.literals = node.literals + pi_literals[p];
+            child.chosen = node.chosen;
+            child.chosen.push_back(p);
+            child.forbidden = excluded;
+            child.uncovered.resize(num_words);
+            for (size_t w = 0; w < num_words; w++) {
+                child.uncovered[w] = node.uncovered[w] & ~pi_cover[p][w];
+            }
+            push(child);
+
+            excluded.push_back(p);
+        }
+
+        for (int p : node.forbidden) is_forbidden[p] = 0;
+    }
+
+    return false;
+}
+
+int CoverEnumerator::disjointLowerBound(const std::vector<uint64_t>& uncovered) const {
+    std::vector<char> used(pi_ids.size(), 0);
+    int bound = 0;
+
+    for (size_t w = 0; w < num_words; w++) {
+        uint64_t bits = uncovered[w];
+        while (bits) {
+            int j = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            bool disjoint = true;
+            for (int p : minterm_pis[j]) {
+                if (used[p]) {
+                    disjoint = false;
+                    break;
+                }
+            }
+            if (disjoint) {
+                bound++;
+                for (int p : minterm_pis[j]) used[p] = 1;
+            }
+        }
+    }
+
+    return bound;
+}
+
+int CoverEnumerator::countLiterals(const std::vector<int>& pi_indices) const {
+    int count = 0;
+    for (int idx : pi_indices) {
+        for (char c : chart.getPrimeImplicants()[idx].value) {
+            if (c != '-') count++;
+        }
+    }
+    return count;
+}
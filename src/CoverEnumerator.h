@@ -0,0 +1,80 @@
+#pragma once
+#include "Petrick.h"
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+// Lazy enumeration of all minimum covers
+// A minimum cover uses the fewest possible PIs. Covers are produced one at
+// a time by next(), ordered by literal count (cheapest first), without ever
+// expanding Petrick's function.
+//
+// Example:
+//   CoverEnumerator covers(pis, minterms, dont_cares);
+//   std::vector<int> cover;
+//   while (covers.next(cover)) { ... pick one by your own cost ... }
+//
+// The minimum PI count is found first with branch-and-bound. The covers are
+// then produced by a best-first search over partial covers that prunes every
+// branch which would need more PIs than that bound. Each child of a search
+// node excludes the PIs of its earlier siblings, so no cover appears twice.
+class CoverEnumerator {
+private:
+    // Partial cover in the best-first search
+    struct Node {
+        int literals;                    // Literals of the chosen PIs
+        int estimate;                    // literals + lower bound on the rest
+        long long seq;                   // Creation order, for deterministic ties
+        std::vector<int> chosen;         // Local PIs taken so far
+        std::vector<int> forbidden;      // Local PIs excluded on this branch
+        std::vector<uint64_t> uncovered; // Bitset of minterms still uncovered
+    };
+
+    struct NodeOrder {
+        bool operator()(const Node& a, const Node& b) const {
+            if (a.estimate != b.estimate) return a.estimate > b.estimate;
+            return a.seq > b.seq;
+        }
+    };
+
+    PrimeImplicantChart chart;
+    std::vector<int> essential_pi_indices;       // Part of every cover
+    std::vector<int> pi_ids;                     // Local PI index -> chart PI index
+    std::vector<int> pi_literals;                // Literal count per local PI
+    std::vector<std::vector<uint64_t>> pi_cover; // Minterms covered per local PI
+    std::vector<std::vector<int>> minterm_pis;   // Local PIs covering each minterm
+    size_t num_minterms;
+    size_t num_words;
+    int min_literals;                            // Cheapest PI, for the estimate
+    int max_pis;                                 // Minimum cover size (remaining part)
+
+    std::priority_queue<Node, std::vector<Node>, NodeOrder> frontier;
+    long long next_seq;
+    long long covers_produced;
+
+    // Minterms whose clauses are pairwise disjoint, each needing its own PI
+    int disjointLowerBound(const std::vector<uint64_t>& uncovered) const;
+
+    // Finish a node's estimate and queue it, unless it cannot stay minimum
+    void push(Node& node);
+
+public:
+    CoverEnumerator(const std::vector<Implicant>& pis,
+                    const std::vector<int>& minterms,
+                    const std::vector<int>& dont_cares);
+
+    // Produce the next minimum cover as sorted PI indices (essentials included)
+    // Returns false when every minimum cover has been produced
+    bool next(std::vector<int>& pi_indices);
+
+    // Number of PIs in every minimum cover
+    int getMinimumPIs() const { return essential_pi_indices.size() + max_pis; }
+
+    // Literal count of a cover, for callers ranking covers themselves
+    int countLiterals(const std::vector<int>& pi_indices) const;
+
+    // Number of covers produced so far
+    long long getCoversProduced() const { return covers_produced; }
+
+    const std::vector<Implicant>& getPrimeImplicants() const { return chart.getPrimeImplicants(); }
+};
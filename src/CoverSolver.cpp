@@ -0,0 +1,17 @@
+#include "CoverSolver.h"
+#include "Petrick.h"
+#include "GreedyCover.h"
+#include "PbSolver.h"
+
+std::unique_ptr<CoverSolver> createCoverSolver(const std::string& name) {
+    if (name == "petrick") {
+        return std::unique_ptr<CoverSolver>(new PetrickSolver());
+    }
+    if (name == "greedy") {
+        return std::unique_ptr<CoverSolver>(new GreedyCoverSolver());
+    }
+    if (name == "pb") {
+        return std::unique_ptr<CoverSolver>(new PbCoverSolver());
+    }
+    return std::unique_ptr<CoverSolver>();
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "QuineMcCluskey.h"
+#include "CoverBudget.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// Common interface of the covering engines
+// A covering engine takes the prime implicants and picks a subset that
+// covers every on-set minterm (don't cares need not be covered).
+class CoverSolver {
+public:
+    virtual ~CoverSolver() {}
+
+    // Main solving function
+    virtual void solve(const std::vector<Implicant>& pis,
+                       const std::vector<int>& minterms,
+                       const std::vector<int>& dont_cares) = 0;
+
+    // Selected PIs
+    virtual std::vector<Implicant> getMinimalCover() const = 0;
+
+    // Display final solution
+    virtual void printSolution() const = 0;
+
+    // Is the selected cover proven minimal?
+    virtual bool isProvenOptimal() const = 0;
+
+    // Best known lower bound on the number of PIs in a minimal cover
+    virtual int getLowerBound() const = 0;
+
+    // Optional settings; engines that don't use them ignore them
+    virtual void setNumThreads(int threads) { (void)threads; }
+    virtual void setBudget(const CoverBudget& limits) { (void)limits; }
+
+    // Engine name as used on the command line
+    virtual const char* getName() const = 0;
+};
+
+// Create a covering engine by name ("petrick", "greedy", "pb")
+// Returns nullptr for an unknown name
+std::unique_ptr<CoverSolver> createCoverSolver(const std::string& name);
@@ -0,0 +1,331 @@
+#include "CoverVerifier.h"
+#include "Console.h"
+#include "Cube.h"
+#include "Espresso.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+// Bits of a word whose minterm has bit b set, for the bits b = 0..5 that
+// vary within a word
+const uint64_t INPUT_MASKS[6] = {
+    0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+    0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+};
+
+// Words evaluated together; a block shares all but the 6 lowest bits of the
+// word index
+const int BLOCK_WORDS = 64;
+
+// Cubes bit-sliced for 64 minterms per word, stored as arrays so the
+// evaluation loop streams through them
+// Minterm m is word m >> 6, bit m & 63; the last character of a cube is
+// bit 0 of m, as in PlaParser::getMinterms.
+struct SlicedCubes {
+    std::vector<uint64_t> low;      // Minterms of a word the six lowest inputs allow
+    std::vector<uint64_t> care;     // Word index bits the cube binds
+    std::vector<uint64_t> value;    // Their values
+
+    void add(const std::string& cube, int num_vars) {
+        // Fewer than 6 inputs: only the first 2^n bits of the single word exist
+        uint64_t mask = num_vars >= 6 ? ~0ULL : (1ULL << (1 << num_vars)) - 1;
+        uint64_t care_bits = 0, value_bits = 0;
+        for (int i = 0; i < num_vars && i < (int)cube.size(); i++) {
+            int bit = num_vars - 1 - i;
+            if (cube[i] != '0' && cube[i] != '1') continue;
+            if (bit < 6) {
+                mask &= cube[i] == '1' ? INPUT_MASKS[bit] : ~INPUT_MASKS[bit];
+            } else {
+                care_bits |= 1ULL << (bit - 6);
+                if (cube[i] == '1') value_bits |= 1ULL << (bit - 6);
+            }
+        }
+        low.push_back(mask);
+        care.push_back(care_bits);
+        value.push_back(value_bits);
+    }
+
+    // The union of the cubes on the block of words starting at first_word (a
+    // multiple of BLOCK_WORDS); words past the input space come out as junk
+    void evaluate(uint64_t first_word, uint64_t* out) const {
+        for (int j = 0; j < BLOCK_WORDS; j++) out[j] = 0;
+        for (size_t c = 0; c < low.size(); c++) {
+            uint64_t cube_low = low[c], cube_care = care[c], cube_value = value[c];
+            // Bound inputs above the block's range rule out the whole block
+            if ((first_word ^ cube_value) & cube_care & ~uint64_t(BLOCK_WORDS - 1)) continue;
+            // Branch-free over a fixed-size block, so the compiler can vectorize it
+            for (int j = 0; j < BLOCK_WORDS; j++) {
+                // All ones when no bound input differs: (t | -t) has bit 63 set iff t != 0
+                uint64_t conflicts = ((first_word + j) ^ cube_value) & cube_care;
+                out[j] |= cube_low & (((conflicts | (0 - conflicts)) >> 63) - 1);
+            }
+        }
+    }
+};
+
+// Counts of a range of blocks and its first wrong minterms
+struct SliceCounts {
+    long long on = 0, dc = 0, uncovered = 0, off_covered = 0;
+    std::vector<uint64_t> uncovered_minterms;
+    std::vector<uint64_t> off_minterms;
+};
+
+void collect(uint64_t word_index, uint64_t bits, std::vector<uint64_t>& minterms, int limit) {
+    while (bits && (int)minterms.size() < limit) {
+        minterms.push_back((word_index << 6) | __builtin_ctzll(bits));
+        bits &= bits - 1;
+    }
+}
+
+SliceCounts checkBlocks(const SlicedCubes& on_set, const SlicedCubes& dc_set,
+                        const SlicedCubes& cover, uint64_t num_words,
+                        uint64_t first_block, uint64_t end_block, int limit) {
+    SliceCounts counts;
+    uint64_t on[BLOCK_WORDS], dc[BLOCK_WORDS], covered[BLOCK_WORDS];
+    for (uint64_t block = first_block; block < end_block; block++) {
+        uint64_t first_word = block * BLOCK_WORDS;
+        int count = (int)std::min<uint64_t>(BLOCK_WORDS, num_words - first_word);
+        on_set.evaluate(first_word, on);
+        dc_set.evaluate(first_word, dc);
+        cover.evaluate(first_word, covered);
+        for (int j = 0; j < count; j++) {
+            uint64_t missing = on[j] & ~covered[j];
+            uint64_t extra = covered[j] & ~(on[j] | dc[j]);
+            counts.on += __builtin_popcountll(on[j]);
+            counts.dc += __builtin_popcountll(dc[j] & ~on[j]);
+            counts.uncovered += __builtin_popcountll(missing);
+            counts.off_covered += __builtin_popcountll(extra);
+            collect(first_word + j, missing, counts.uncovered_minterms, limit);
+            collect(first_word + j, extra, counts.off_minterms, limit);
+        }
+    }
+    return counts;
+}
+
+std::string mintermString(uint64_t minterm, int num_vars) {
+    std::string text(num_vars, '0');
+    for (int i = 0; i < num_vars; i++) {
+        if ((minterm >> (num_vars - 1 - i)) & 1) text[i] = '1';
+    }
+    return text;
+}
+
+bool cubeContains(const std::string& cube, const std::string& minterm) {
+    for (size_t i = 0; i < minterm.size() && i < cube.size(); i++) {
+        if ((cube[i] == '0' || cube[i] == '1') && cube[i] != minterm[i]) return false;
+    }
+    return true;
+}
+
+// A minterm of c that f does not cover (f must not cover all of c): halve c
+// until one point is left, always keeping a half f does not cover
+Cube uncoveredPoint(const Cover& f, Cube c) {
+    for (int v = 0; v < c.getNumVars(); v++) {
+        if (c.get(v) != 3) continue;
+        c.set(v, 1);
+        if (EspressoMinimizer::tautology(EspressoMinimizer::cofactor(f, c))) c.set(v, 2);
+    }
+    return c;
+}
+
+}  // namespace
+
+CoverVerifier::CoverVerifier(int threads) : num_threads(threads) {}
+
+void CoverVerifier::reset() {
+    num_vars = 0;
+    sliced = false;
+    equivalent = false;
+    error.clear();
+    on_minterms = dc_minterms = uncovered = off_covered = 0;
+    counterexamples.clear();
+    seconds = 0;
+}
+
+bool CoverVerifier::verify(const PlaParser& spec, const PlaParser& cover) {
+    auto start = std::chrono::steady_clock::now();
+    reset();
+    num_vars = spec.getNumInputs();
+
+    if (cover.getNumInputs() != num_vars) {
+        std::ostringstream message;
+        message << "the cover has " << cover.getNumInputs() << " inputs, the specification "
+                << num_vars;
+        error = message.str();
+        return false;
+    }
+    if (num_vars > Cube::MAX_VARS) {
+        error = "too many inputs to verify";
+        return false;
+    }
+
+    std::vector<std::string> cover_cubes;
+    for (const auto& term : cover.getProductTerms()) {
+        if (term.output == "1") cover_cubes.push_back(term.cube);
+    }
+
+    if (num_vars <= MAX_SLICED_INPUTS) {
+        verifySliced(spec.getProductTerms(), cover_cubes);
+    } else {
+        verifyCubes(spec.getProductTerms(), cover_cubes);
+    }
+    equivalent = uncovered == 0 && off_covered == 0;
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return equivalent;
+}
+
+bool CoverVerifier::verifyFiles(const std::string& spec_pla, const std::string& cover_pla) {
+    PlaParser spec, cover;
+    const PlaParser* unreadable = nullptr;
+    if (!spec.parse(spec_pla)) {
+        unreadable = &spec;
+    } else if (!cover.parse(cover_pla)) {
+        unreadable = &cover;
+    }
+    if (unreadable) {
+        reset();
+        error = (unreadable == &spec ? spec_pla : cover_pla) + ": " + unreadable->getError();
+        return false;
+    }
+    return verify(spec, cover);
+}
+
+void CoverVerifier::verifySliced(const std::vector<ProductTerm>& spec,
+                                 const std::vector<std::string>& cover) {
+    sliced = true;
+    SlicedCubes on_set, dc_set, cover_set;
+    for (const auto& term : spec) {
+        (term.output == "1" ? on_set : dc_set).add(term.cube, num_vars);
+    }
+    for (const auto& cube : cover) cover_set.add(cube, num_vars);
+
+    uint64_t num_words = num_vars > 6 ? 1ULL << (num_vars - 6) : 1;
+    uint64_t num_blocks = (num_words + BLOCK_WORDS - 1) / BLOCK_WORDS;
+
+    // A few ranges per thread, merged in order so the counterexamples are the
+    // lowest minterms whatever the thread count
+    ThreadPool pool(num_threads);
+    uint64_t num_ranges = std::min<uint64_t>(num_blocks, pool.size() * 4);
+    std::vector<std::future<SliceCounts>> ranges;
+    for (uint64_t r = 0; r < num_ranges; r++) {
+        uint64_t first = num_blocks * r / num_ranges, end = num_blocks * (r + 1) / num_ranges;
+        ranges.push_back(pool.submit([&on_set, &dc_set, &cover_set, num_words, first, end]() {
+            return checkBlocks(on_set, dc_set, cover_set, num_words, first, end,
+                               MAX_COUNTEREXAMPLES);
+        }));
+    }
+
+    std::vector<uint64_t> missing, extra;
+    for (auto& range : ranges) {
+        SliceCounts counts = range.get();
+        on_minterms += counts.on;
+        dc_minterms += counts.dc;
+        uncovered += counts.uncovered;
+        off_covered += counts.off_covered;
+        missing.insert(missing.end(), counts.uncovered_minterms.begin(), counts.uncovered_minterms.end());
+        extra.insert(extra.end(), counts.off_minterms.begin(), counts.off_minterms.end());
+    }
+
+    for (size_t i = 0; i < missing.size() && i < (size_t)MAX_COUNTEREXAMPLES; i++) {
+        counterexamples.push_back({mintermString(missing[i], num_vars), true, ""});
+    }
+    for (size_t i = 0; i < extra.size() && i < (size_t)MAX_COUNTEREXAMPLES; i++) {
+        Counterexample example = {mintermString(extra[i], num_vars), false, ""};
+        for (const auto& cube : cover) {
+            if (cubeContains(cube, example.minterm)) {
+                example.cube = cube;
+                break;
+            }
+        }
+        counterexamples.push_back(example);
+    }
+}
+
+void CoverVerifier::verifyCubes(const std::vector<ProductTerm>& spec,
+                                const std::vector<std::string>& cover) {
+    Cover on_set, care_set, cover_set;
+    for (const auto& term : spec) {
+        Cube cube = Cube::fromString(term.cube);
+        if (term.output == "1") on_set.push_back(cube);
+        care_set.push_back(cube);
+    }
+    for (const auto& cube : cover) cover_set.push_back(Cube::fromString(cube));
+
+    // Every on-set cube must lie inside the cover, every cover cube inside the
+    // on-set plus don't cares; one task per cube
+    ThreadPool pool(num_threads);
+    std::vector<std::future<bool>> inside_cover, inside_care;
+    for (const Cube& cube : on_set) {
+        inside_cover.push_back(pool.submit([&cover_set, cube]() {
+            return EspressoMinimizer::tautology(EspressoMinimizer::cofactor(cover_set, cube));
+        }));
+    }
+    for (const Cube& cube : cover_set) {
+        inside_care.push_back(pool.submit([&care_set, cube]() {
+            return EspressoMinimizer::tautology(EspressoMinimizer::cofactor(care_set, cube));
+        }));
+    }
+
+    int missing = 0, extra = 0;
+    for (size_t i = 0; i < on_set.size(); i++) {
+        if (inside_cover[i].get()) continue;
+        uncovered++;
+        if (missing++ < MAX_COUNTEREXAMPLES) {
+            counterexamples.push_back({uncoveredPoint(cover_set, on_set[i]).toString(), true, ""});
+        }
+    }
+    for (size_t i = 0; i < cover_set.size(); i++) {
+        if (inside_care[i].get()) continue;
+        off_covered++;
+        if (extra++ < MAX_COUNTEREXAMPLES) {
+            counterexamples.push_back({uncoveredPoint(care_set, cover_set[i]).toString(), false,
+                                       cover[i]});
+        }
+    }
+}
+
+std::string CoverVerifier::describeFailure() const {
+    if (!error.empty()) return error;
+    if (equivalent) return "";
+    const char* unit = sliced ? " minterms" : " cubes";
+    std::ostringstream message;
+    message << "the cover differs from the specification: " << uncovered << " on-set" << unit
+            << " not covered, " << off_covered << (sliced ? " off-set minterms covered" :
+                                                             " cover cubes reach the off-set");
+    return message.str();
+}
+
+void CoverVerifier::printResult() const {
+    LOG(SUMMARY) << "\n[Verify] Equivalence Check" << std::endl;
+    if (!error.empty()) {
+        LOG(SUMMARY) << "  ✗ Not checked: " << error << std::endl;
+        return;
+    }
+    if (sliced) {
+        LOG(SUMMARY) << "  Bit-sliced over all 2^" << num_vars << " minterms (" << on_minterms
+                     << " on-set, " << dc_minterms << " don't cares)" << std::endl;
+    } else {
+        LOG(SUMMARY) << "  Cube containment (" << num_vars << " inputs, more than "
+                     << MAX_SLICED_INPUTS << " to enumerate)" << std::endl;
+    }
+    if (equivalent) {
+        LOG(SUMMARY) << "  ✓ Cover is equivalent to the specification (" << std::fixed
+                     << std::setprecision(3) << seconds << " s)" << std::defaultfloat << std::endl;
+        return;
+    }
+    LOG(SUMMARY) << "  ✗ " << describeFailure() << std::endl;
+    for (const auto& example : counterexamples) {
+        if (example.on_set) {
+            LOG(SUMMARY) << "    on-set  " << example.minterm << " not covered" << std::endl;
+        } else {
+            LOG(SUMMARY) << "    off-set " << example.minterm << " covered by " << example.cube
+                         << std::endl;
+        }
+    }
+}
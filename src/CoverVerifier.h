@@ -0,0 +1,67 @@
+#pragma once
+#include "PlaParser.h"
+#include <string>
+#include <vector>
+
+// Equivalence check of a written cover against its specification (--verify,
+// tools/verify_pla)
+// The cover must contain every on-set minterm of the specification and no
+// off-set minterm (everything outside the on-set and the don't cares).
+//
+// Up to MAX_SLICED_INPUTS inputs every minterm is checked, bit-sliced: a
+// 64-bit word holds 64 consecutive minterms, which share all but the six
+// lowest inputs. Each cube becomes a mask over those six inputs plus a test
+// on the others, so evaluating a cube on 64 minterms is one compare and one
+// AND. Blocks of words are evaluated by the worker threads.
+// With more inputs the input space is too large to walk, and the check is
+// cube containment with the tautology test of the Espresso engine instead.
+class CoverVerifier {
+public:
+    static const int MAX_SLICED_INPUTS = 28;
+    static const int MAX_COUNTEREXAMPLES = 8;   // Of each kind
+
+    // A minterm on the wrong side
+    struct Counterexample {
+        std::string minterm;        // Input values, e.g. "0110"
+        bool on_set;                // On-set minterm missing from the cover,
+                                    // else off-set minterm inside the cover
+        std::string cube;           // Cover cube containing the off-set minterm
+    };
+
+private:
+    int num_threads;
+
+    // Result of the last check
+    int num_vars = 0;
+    bool sliced = false;            // Minterms checked (else cubes)
+    bool equivalent = false;
+    std::string error;              // Why the files could not be compared
+    long long on_minterms = 0;      // Bit-sliced check only
+    long long dc_minterms = 0;
+    long long uncovered = 0;        // On-set minterms (cubes) not covered
+    long long off_covered = 0;      // Off-set minterms (cover cubes) inside the off-set
+    std::vector<Counterexample> counterexamples;
+    double seconds = 0;
+
+    void reset();
+    void verifySliced(const std::vector<ProductTerm>& spec, const std::vector<std::string>& cover);
+    void verifyCubes(const std::vector<ProductTerm>& spec, const std::vector<std::string>& cover);
+
+public:
+    // num_threads <= 0 uses all cores
+    explicit CoverVerifier(int threads = 0);
+
+    // Check the "1" terms of cover against spec; true if they are equivalent
+    bool verify(const PlaParser& spec, const PlaParser& cover);
+
+    // The same for two PLA files
+    bool verifyFiles(const std::string& spec_pla, const std::string& cover_pla);
+
+    bool isEquivalent() const { return equivalent; }
+    const std::vector<Counterexample>& getCounterexamples() const { return counterexamples; }
+
+    // One line: why the check failed (empty if equivalent)
+    std::string describeFailure() const;
+
+    void printResult() const;
+};
@@ -0,0 +1,150 @@
+#include "Cube.h"
+
+const uint64_t Cube::LOW_BITS;
+const int Cube::MAX_VARS;
+const int Cube::MAX_WORDS;
+
+uint64_t Cube::wordMask(int w) const {
+    int vars_in_word = num_vars - 32 * w;
+    if (vars_in_word >= 32) return ~uint64_t(0);
+    return (uint64_t(1) << (2 * vars_in_word)) - 1;
+}
+
+Cube Cube::universe(int num_vars) {
+    Cube c;
+    c.num_vars = num_vars;
+    c.num_words = (num_vars + 31) / 32;
+    for (int w = 0; w < c.num_words; w++) {
+        c.bits[w] = c.wordMask(w);
+    }
+    return c;
+}
+
+Cube Cube::fromString(const std::string& text) {
+    if (text.size() > size_t(MAX_VARS)) return Cube();
+    Cube c = universe(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '0') c.set(i, 1);
+        else if (text[i] == '1') c.set(i, 2);
+    }
+    return c;
+}
+
+std::string Cube::toString() const {
+    static const char symbol[4] = {'?', '0', '1', '-'};
+    std::string text(num_vars, '-');
+    for (int i = 0; i < num_vars; i++) {
+        text[i] = symbol[get(i)];
+    }
+    return text;
+}
+
+void Cube::set(int var, int field) {
+    int shift = 2 * (var % 32);
+    uint64_t& word = bits[var / 32];
+    word = (word & ~(uint64_t(3) << shift)) | (uint64_t(field) << shift);
+}
+
+bool Cube::isEmpty() const {
+    for (int w = 0; w < num_words; w++) {
+        // A field is non-empty if either of its bits is set
+        uint64_t present = (bits[w] | (bits[w] >> 1)) & LOW_BITS;
+        if (present != (LOW_BITS & wordMask(w))) return true;
+    }
+    return false;
+}
+
+bool Cube::isUniverse() const {
+    for (int w = 0; w < num_words; w++) {
+        if (bits[w] != wordMask(w)) return false;
+    }
+    return true;
+}
+
+int Cube::literalCount() const {
+    int free_vars = 0;
+    for (int w = 0; w < num_words; w++) {
+        free_vars += __builtin_popcountll(bits[w] & (bits[w] >> 1) & LOW_BITS);
+    }
+    return num_vars - free_vars;
+}
+
+bool Cube::contains(const Cube& other) const {
+    for (int w = 0; w < num_words; w++) {
+        if (other.bits[w] & ~bits[w]) return false;
+    }
+    return true;
+}
+
+bool Cube::intersects(const Cube& other) const {
+    for (int w = 0; w < num_words; w++) {
+        uint64_t both = bits[w] & other.bits[w];
+        uint64_t present = (both | (both >> 1)) & LOW_BITS;
+        if (present != (LOW_BITS & wordMask(w))) return false;
+    }
+    return true;
+}
+
+Cube Cube::intersect(const Cube& other) const {
+    Cube c = *this;
+    for (int w = 0; w < num_words; w++) {
+        c.bits[w] &= other.bits[w];
+    }
+    return c;
+}
+
+Cube Cube::supercube(const Cube& other) const {
+    Cube c = *this;
+    for (int w = 0; w < num_words; w++) {
+        c.bits[w] |= other.bits[w];
+    }
+    return c;
+}
+
+int Cube::distance(const Cube& other) const {
+    int conflicts = 0;
+    for (int w = 0; w < num_words; w++) {
+        uint64_t both = bits[w] & other.bits[w];
+        uint64_t present = (both | (both >> 1)) & LOW_BITS;
+        conflicts += __builtin_popcountll(~present & LOW_BITS & wordMask(w));
+    }
+    return conflicts;
+}
+
+Cube Cube::consensus(const Cube& other) const {
+    Cube c = *this;
+    for (int w = 0; w < num_words; w++) {
+        uint64_t both = bits[w] & other.bits[w];
+        uint64_t present = (both | (both >> 1)) & LOW_BITS;
+        uint64_t conflict = ~present & LOW_BITS & wordMask(w);
+        c.bits[w] = both | conflict | (conflict << 1);
+    }
+    return c;
+}
+
+Cube Cube::cofactor(const Cube& c) const {
+    Cube result = *this;
+    for (int w = 0; w < num_words; w++) {
+        // Fields where c is '-' keep their value, the others become '-'
+        uint64_t free_low = c.bits[w] & (c.bits[w] >> 1) & LOW_BITS;
+        uint64_t free_mask = free_low | (free_low << 1);
+        result.bits[w] |= ~free_mask & wordMask(w);
+    }
+    return result;
+}
+
+bool Cube::operator==(const Cube& other) const {
+    if (num_vars != other.num_vars) return false;
+    for (int w = 0; w < num_words; w++) {
+        if (bits[w] != other.bits[w]) return false;
+    }
+    return true;
+}
+
+bool Cube::operator<(const Cube& other) const {
+    if (num_vars != other.num_vars) return num_vars < other.num_vars;
+    for (int w = 0; w < num_words; w++) {
+        if (bits[w] != other.bits[w]) return bits[w] < other.bits[w];
+    }
+    return false;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A product term over any number of inputs, in positional cube notation
+// Every variable takes two bits: bit 0 = "may be 0", bit 1 = "may be 1".
+//   '0' -> 01, '1' -> 10, '-' -> 11, 00 = empty (no point satisfies the cube)
+// With this encoding intersection is AND, supercube is OR and containment
+// is a subset test on the bits, 32 variables per 64-bit word.
+// The words are stored inline (no allocation per cube), up to MAX_VARS.
+class Cube {
+public:
+    static const int MAX_VARS = 128;
+
+private:
+    static const int MAX_WORDS = MAX_VARS / 32;
+
+    int num_vars;
+    int num_words;
+    uint64_t bits[MAX_WORDS];
+
+    static const uint64_t LOW_BITS = 0x5555555555555555ULL;  // Bit 0 of every field
+
+    // Valid bits of word w (the last word may be partly unused)
+    uint64_t wordMask(int w) const;
+
+public:
+    Cube() : num_vars(0), num_words(0), bits() {}
+
+    // Cube with every variable free ('-')
+    static Cube universe(int num_vars);
+
+    // Parse "10-1"; characters other than '0' and '1' are treated as '-'
+    // Text longer than MAX_VARS does not fit and gives an empty Cube() (no
+    // variables); callers check the length against their input count first.
+    static Cube fromString(const std::string& text);
+    std::string toString() const;
+
+    int getNumVars() const { return num_vars; }
+
+    // Raw 64-bit words (32 variables each), for loops over many cubes
+    size_t numWords() const { return num_words; }
+    uint64_t word(size_t w) const { return bits[w]; }
+
+    // Field of a variable: 1 = '0', 2 = '1', 3 = '-', 0 = empty
+    int get(int var) const { return (bits[var / 32] >> (2 * (var % 32))) & 3; }
+    void set(int var, int field);
+
+    bool isEmpty() const;             // Some variable is 00
+    bool isUniverse() const;          // Every variable is '-'
+    int literalCount() const;         // Variables that are not '-'
+
+    bool contains(const Cube& other) const;     // other is a subset of this
+    bool intersects(const Cube& other) const;
+    Cube intersect(const Cube& other) const;
+    Cube supercube(const Cube& other) const;    // Smallest cube containing both
+    int distance(const Cube& other) const;      // Variables where the cubes conflict
+
+    // Consensus of two cubes at distance 1: their intersection with the
+    // conflicting variable freed
+    Cube consensus(const Cube& other) const;
+
+    // Cofactor with respect to cube c (assumes the cubes intersect):
+    // the variables bound by c become '-'
+    Cube cofactor(const Cube& c) const;
+
+    bool operator==(const Cube& other) const;
+    bool operator<(const Cube& other) const;
+};
+
+// A sum of products
+typedef std::vector<Cube> Cover;
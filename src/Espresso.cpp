@@ -0,0 +1,330 @@
+#include "Espresso.h"
+#include "Console.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// ==================== Unate Recursive Helpers ====================
+
+// Cube with a single literal: var = 0 (field 1) or var = 1 (field 2)
+static Cube literalCube(int num_vars, int var, int field) {
+    Cube c = Cube::universe(num_vars);
+    c.set(var, field);
+    return c;
+}
+
+// Count the literals of every variable: zeros[v] cubes have v = 0, ones[v]
+// have v = 1. Only the literal fields are visited, word by word.
+static void countLiterals(const Cover& f, int num_vars,
+                          std::vector<int>& zeros, std::vector<int>& ones) {
+    const uint64_t low_bits = 0x5555555555555555ULL;
+    zeros.assign(num_vars, 0);
+    ones.assign(num_vars, 0);
+    for (const auto& c : f) {
+        for (size_t w = 0; w < c.numWords(); w++) {
+            uint64_t x = c.word(w);
+            uint64_t can0 = x & low_bits;
+            uint64_t can1 = (x >> 1) & low_bits;
+            for (uint64_t only0 = can0 & ~can1; only0; only0 &= only0 - 1) {
+                zeros[w * 32 + __builtin_ctzll(only0) / 2]++;
+            }
+            for (uint64_t only1 = can1 & ~can0; only1; only1 &= only1 - 1) {
+                ones[w * 32 + __builtin_ctzll(only1) / 2]++;
+            }
+        }
+    }
+}
+
+// Splitting variable: the most binate one (appearing in both polarities
+// in the most cubes). binate is false if the cover is unate; then the
+// variable with the most literals is returned, or -1 if there is none.
+static int selectSplitVar(const std::vector<int>& zeros, const std::vector<int>& ones,
+                          bool& binate) {
+    int best = -1;
+    binate = false;
+    for (size_t v = 0; v < zeros.size(); v++) {
+        bool is_binate = zeros[v] > 0 && ones[v] > 0;
+        int count = zeros[v] + ones[v];
+        if (count == 0) continue;
+        if (best < 0 || (is_binate && !binate) ||
+            (is_binate == binate && count > zeros[best] + ones[best])) {
+            best = v;
+            binate = is_binate;
+        }
+    }
+    return best;
+}
+
+// Drop cubes contained in another cube (single cube containment)
+static Cover removeContained(Cover f) {
+    std::sort(f.begin(), f.end(), [](const Cube& a, const Cube& b) {
+        return a.literalCount() < b.literalCount();
+    });
+    Cover result;
+    for (const auto& c : f) {
+        bool contained = false;
+        for (const auto& kept : result) {
+            if (kept.contains(c)) {
+                contained = true;
+                break;
+            }
+        }
+        if (!contained) result.push_back(c);
+    }
+    return result;
+}
+
+Cover EspressoMinimizer::cofactor(const Cover& f, const Cube& c) {
+    Cover result;
+    for (const auto& cube : f) {
+        if (cube.intersects(c)) {
+            result.push_back(cube.cofactor(c));
+        }
+    }
+    return result;
+}
+
+bool EspressoMinimizer::tautology(const Cover& f) {
+    if (f.empty()) return false;
+
+    int num_vars = f[0].getNumVars();
+    double volume = 0;  // Fraction of the space the cubes add up to
+    for (const auto& c : f) {
+        if (c.isUniverse()) return true;
+        volume += std::ldexp(1.0, -c.literalCount());
+    }
+    if (volume < 1.0) return false;  // Not enough points to fill the space
+
+    std::vector<int> zeros, ones;
+    countLiterals(f, num_vars, zeros, ones);
+
+    // Unate reduction: if v only appears as x (never x'), f is a tautology
+    // iff its cofactor by x' is, and that just drops the cubes using x
+    Cube unate_vars = Cube::universe(num_vars);
+    bool has_unate = false;
+    for (int v = 0; v < num_vars; v++) {
+        if ((zeros[v] > 0) != (ones[v] > 0)) {
+            unate_vars.set(v, zeros[v] > 0 ? 2 : 1);  // The opposite literal
+            has_unate = true;
+        }
+    }
+    if (has_unate) {
+        return tautology(cofactor(f, unate_vars));
+    }
+
+    // Every variable left is binate: split on the most binate one
+    bool binate;
+    int v = selectSplitVar(zeros, ones, binate);
+    return tautology(cofactor(f, literalCube(num_vars, v, 1))) &&
+           tautology(cofactor(f, literalCube(num_vars, v, 2)));
+}
+
+// ==================== EspressoMinimizer Implementation ====================
+
+EspressoMinimizer::EspressoMinimizer(int num_variables)
+    : num_vars(num_variables), input_cubes(0), iterations(0) {
+}
+
+bool EspressoMinimizer::isImplicant(const Cube& c) const {
+    for (const auto& cube : care_set) {
+        if (cube.contains(c)) return true;
+    }
+    return tautology(cofactor(care_set, c));
+}
+
+long long EspressoMinimizer::cost(const Cover& f) {
+    long long literals = 0;
+    for (const auto& c : f) literals += c.literalCount();
+    return (long long)f.size() * 1000000 + literals;
+}
+
+Cover EspressoMinimizer::expand(const Cover& f) const {
+    // Largest cubes first: they are the most likely to swallow others
+    Cover cubes = f;
+    std::stable_sort(cubes.begin(), cubes.end(), [](const Cube& a, const Cube& b) {
+        return a.literalCount() < b.literalCount();
+    });
+
+    std::vector<char> covered(cubes.size(), 0);
+    Cover result;
+
+    for (size_t i = 0; i < cubes.size(); i++) {
+        if (covered[i]) continue;
+        Cube c = cubes[i];
+
+        // First grow c to swallow nearby cubes (nearest first) while the
+        // supercube stays inside the function
+        std::vector<std::pair<int, size_t>> nearest;  // (literals to raise, cube)
+        for (size_t j = i + 1; j < cubes.size(); j++) {
+            if (!covered[j]) {
+                int raise = c.literalCount() - c.supercube(cubes[j]).literalCount();
+                if (raise <= MAX_ABSORB_RAISE) nearest.push_back(std::make_pair(raise, j));
+            }
+        }
+        std::sort(nearest.begin(), nearest.end());
+        for (const auto& entry : nearest) {
+            Cube merged = c.supercube(cubes[entry.second]);
+            if (isImplicant(merged)) c = merged;
+        }
+
+        // Raise first the literals that keep the most uncovered cubes out
+        std::vector<std::pair<int, int>> order;  // (-score, var)
+        for (int v = 0; v < num_vars; v++) {
+            int field = c.get(v);
+            if (field == 3) continue;
+            int score = 0;
+            for (size_t j = i + 1; j < cubes.size(); j++) {
+                if (!covered[j] && cubes[j].get(v) != field) score++;
+            }
+            order.push_back(std::make_pair(-score, v));
+        }
+        std::sort(order.begin(), order.end());
+
+        for (const auto& entry : order) {
+            int v = entry.second;
+            Cube raised = c;
+            raised.set(v, 3);
+
+            if (isImplicant(raised)) c = raised;
+        }
+
+        for (size_t j = i + 1; j < cubes.size(); j++) {
+            if (!covered[j] && c.contains(cubes[j])) covered[j] = 1;
+        }
+        result.push_back(c);
+    }
+
+    return removeContained(result);
+}
+
+Cover EspressoMinimizer::irredundant(const Cover& f) const {
+    // Try to drop the smallest cubes (most literals) first
+    std::vector<size_t> order(f.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&f](size_t a, size_t b) {
+        return f[a].literalCount() > f[b].literalCount();
+    });
+
+    std::vector<char> removed(f.size(), 0);
+    for (size_t i : order) {
+        Cover rest = dc_set;
+        for (size_t j = 0; j < f.size(); j++) {
+            if (j != i && !removed[j]) rest.push_back(f[j]);
+        }
+        if (tautology(cofactor(rest, f[i]))) {
+            removed[i] = 1;
+        }
+    }
+
+    Cover result;
+    for (size_t i = 0; i < f.size(); i++) {
+        if (!removed[i]) result.push_back(f[i]);
+    }
+    return result;
+}
+
+Cover EspressoMinimizer::reduce(const Cover& f) const {
+    // Reduce the largest cubes first
+    Cover cubes = f;
+    std::stable_sort(cubes.begin(), cubes.end(), [](const Cube& a, const Cube& b) {
+        return a.literalCount() < b.literalCount();
+    });
+
+    std::vector<char> removed(cubes.size(), 0);
+    for (size_t i = 0; i < cubes.size(); i++) {
+        Cover rest = dc_set;
+        for (size_t j = 0; j < cubes.size(); j++) {
+            if (j != i && !removed[j]) rest.push_back(cubes[j]);
+        }
+
+        // Shrink to the smallest cube holding the points nobody else covers:
+        // v can be fixed to 0 exactly when the v = 1 half is already covered
+        Cover local = cofactor(rest, cubes[i]);
+        if (tautology(local)) {
+            removed[i] = 1;  // Entirely covered by the others
+            continue;
+        }
+
+        Cube c = cubes[i];
+        for (int v = 0; v < num_vars; v++) {
+            if (c.get(v) != 3) continue;
+            if (tautology(cofactor(local, literalCube(num_vars, v, 2)))) {
+                c.set(v, 1);
+                local = cofactor(local, literalCube(num_vars, v, 1));
+            } else if (tautology(cofactor(local, literalCube(num_vars, v, 1)))) {
+                c.set(v, 2);
+                local = cofactor(local, literalCube(num_vars, v, 2));
+            }
+        }
+        cubes[i] = c;
+    }
+
+    Cover result;
+    for (size_t i = 0; i < cubes.size(); i++) {
+        if (!removed[i]) result.push_back(cubes[i]);
+    }
+    return result;
+}
+
+void EspressoMinimizer::minimize(const std::vector<ProductTerm>& terms) {
+    on_set.clear();
+    dc_set.clear();
+    for (const auto& term : terms) {
+        Cube c = Cube::fromString(term.cube);
+        if (term.output == "1") on_set.push_back(c);
+        else dc_set.push_back(c);
+    }
+    input_cubes = on_set.size();
+    iterations = 0;
+
+    LOG(SUMMARY) << "\n[Step 2] Espresso Heuristic Minimization" << std::endl;
+    LOG(SUMMARY) << "  ✓ On-set cubes: " << on_set.size()
+                 << ", don't-care cubes: " << dc_set.size() << std::endl;
+
+    care_set = on_set;
+    care_set.insert(care_set.end(), dc_set.begin(), dc_set.end());
+
+    cover = removeContained(on_set);
+    if (cover.empty()) {
+        return;
+    }
+
+    cover = irredundant(expand(cover));
+    LOG(SUMMARY) << "  ✓ EXPAND + IRREDUNDANT: " << cover.size() << " cubes" << std::endl;
+
+    while (true) {
+        iterations++;
+        Cover next = irredundant(expand(reduce(cover)));
+        if (cost(next) >= cost(cover)) break;
+        cover = next;
+        LOG(SUMMARY) << "  ✓ Iteration " << iterations << " (REDUCE, EXPAND, IRREDUNDANT): "
+                     << cover.size() << " cubes" << std::endl;
+    }
+}
+
+std::vector<Implicant> EspressoMinimizer::getCover() const {
+    std::vector<Implicant> result;
+    for (const auto& c : cover) {
+        result.push_back(Implicant(c.toString(), std::set<int>()));
+    }
+    std::sort(result.begin(), result.end(), [](const Implicant& a, const Implicant& b) {
+        return a.value < b.value;
+    });
+    return result;
+}
+
+void EspressoMinimizer::printSolution() const {
+    LOG(SUMMARY) << "\n╔═══════════════════════════════════════════════════════════════╗\n";
+    LOG(SUMMARY) << "║          FINAL COVER (ESPRESSO HEURISTIC)                     ║\n";
+    LOG(SUMMARY) << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+
+    int literals = 0;
+    for (const auto& imp : getCover()) {
+        LOG(SUMMARY) << "   " << imp.value << "\n";
+        for (char ch : imp.value) {
+            if (ch != '-') literals++;
+        }
+    }
+    LOG(SUMMARY) << "\nTotal: " << cover.size() << " cubes (from " << input_cubes << " input cubes), "
+                 << literals << " literals, " << iterations << " REDUCE/EXPAND passes\n";
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "Cube.h"
+#include "PlaParser.h"
+#include "QuineMcCluskey.h"
+#include <vector>
+
+// Espresso-style heuristic two-level minimizer
+// Works directly on the cubes of the PLA file and never enumerates
+// minterms, so it handles functions with many inputs (30-60 and more).
+// The result is a valid, irredundant cover, but not necessarily minimal.
+//
+// Starting from the on-set cubes F and the don't-care cubes D:
+//   EXPAND:      raise literals of each cube while it stays inside F + D,
+//                then drop the cubes it now contains
+//   IRREDUNDANT: drop every cube covered by the other cubes plus D
+//   REDUCE:      shrink each cube to the smallest cube still covering the
+//                part of the function only it covers (one containment
+//                check per free variable)
+// REDUCE -> EXPAND -> IRREDUNDANT is repeated while the cost (product
+// terms, then literals) keeps going down.
+//
+// Every covering question is a containment check answered with the unate
+// recursive paradigm: "is cube c inside cover G?" is "is G cofactored by c
+// a tautology?". The off-set is never built, since complementing functions
+// with many inputs can produce far more cubes than the function has.
+class EspressoMinimizer {
+private:
+    int num_vars;
+    Cover on_set;
+    Cover dc_set;
+    Cover care_set;                    // On-set plus don't-care cubes
+    Cover cover;
+
+    // Statistics for printSolution
+    int input_cubes;
+    int iterations;
+
+    // EXPAND only tries to swallow cubes this many raised literals away
+    static const int MAX_ABSORB_RAISE = 2;
+
+    // The three Espresso operators
+    Cover expand(const Cover& f) const;
+    Cover irredundant(const Cover& f) const;
+    Cover reduce(const Cover& f) const;
+
+    // Is c inside the on-set plus don't cares?
+    bool isImplicant(const Cube& c) const;
+
+    // Cost of a cover: product terms first, then literals
+    static long long cost(const Cover& f);
+
+public:
+    explicit EspressoMinimizer(int num_variables);
+
+    // Minimize the on-set ("1") and don't-care ("-") cubes of a PLA file
+    void minimize(const std::vector<ProductTerm>& terms);
+
+    // Result as implicants for PlaWriter (minterm sets are left empty)
+    std::vector<Implicant> getCover() const;
+
+    void printSolution() const;
+
+    // ==== Unate recursive paradigm ====
+
+    // Cofactor of every cube of f that intersects c
+    static Cover cofactor(const Cover& f, const Cube& c);
+
+    // Does f cover every point?
+    static bool tautology(const Cover& f);
+};
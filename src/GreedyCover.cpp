@@ -0,0 +1,327 @@
+#include "GreedyCover.h"
+#include "Console.h"
+#include "BranchAndBound.h"
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <queue>
+
+// ==================== Heuristic Covering Core ====================
+
+namespace {
+
+// Working state of the heuristic on one set of clauses
+struct GreedyState {
+    std::vector<std::vector<int>> pi_minterms;  // Minterms (clause indices) covered by each local PI
+    std::vector<std::vector<int>> minterm_pis;  // Local PIs covering each minterm
+    std::vector<long long> cost;                // PI cost: scale + literals
+    std::vector<char> selected;
+    std::vector<int> cover_count;               // Selected PIs covering each minterm
+
+    void select(int p) {
+        selected[p] = 1;
+        for (int m : pi_minterms[p]) cover_count[m]++;
+    }
+
+    void deselect(int p) {
+        selected[p] = 0;
+        for (int m : pi_minterms[p]) cover_count[m]--;
+    }
+
+    // The only selected PI covering minterm m (cover_count[m] == 1)
+    int soleCover(int m) const {
+        for (int p : minterm_pis[m]) {
+            if (selected[p]) return p;
+        }
+        return -1;
+    }
+
+    // Number of minterms that only p covers
+    int uniqueCount(int p) const {
+        int n = 0;
+        for (int m : pi_minterms[p]) {
+            if (cover_count[m] == 1) n++;
+        }
+        return n;
+    }
+};
+
+// Drop selected PIs whose minterms are all covered twice, most expensive first
+void removeRedundant(GreedyState& st) {
+    std::vector<int> order;
+    for (size_t p = 0; p < st.selected.size(); p++) {
+        if (st.selected[p]) order.push_back(p);
+    }
+    std::stable_sort(order.begin(), order.end(), [&st](int a, int b) {
+        return st.cost[a] > st.cost[b];
+    });
+
+    for (int p : order) {
+        bool redundant = true;
+        for (int m : st.pi_minterms[p]) {
+            if (st.cover_count[m] < 2) {
+                redundant = false;
+                break;
+            }
+        }
+        if (redundant) st.deselect(p);
+    }
+}
+
+// Try one improving 1-swap or 2-swap; returns true if the cover changed
+bool improveOnce(GreedyState& st) {
+    const size_t num_pis = st.selected.size();
+    std::vector<int> hits(num_pis, 0);
+    std::vector<int> touched;
+
+    for (size_t q = 0; q < num_pis; q++) {
+        if (st.selected[q]) continue;
+
+        // Count, per selected PI, how many of its unique minterms q covers
+        touched.clear();
+        for (int m : st.pi_minterms[q]) {
+            if (st.cover_count[m] == 1) {
+                int s = st.soleCover(m);
+                if (hits[s]++ == 0) touched.push_back(s);
+            }
+        }
+
+        // Selected PIs that q could fully replace
+        std::vector<int> replaceable;
+        for (int s : touched) {
+            if (hits[s] == st.uniqueCount(s)) replaceable.push_back(s);
+        }
+        for (int s : touched) hits[s] = 0;
+
+        // 2-swap: q replaces two PIs s1, s2 if it also covers the minterms
+        // that only s1 and s2 cover together
+        for (size_t a = 0; a < replaceable.size(); a++) {
+            for (size_t b = a + 1; b < replaceable.size(); b++) {
+                int s1 = replaceable[a];
+                int s2 = replaceable[b];
+                if (st.cost[q] >= st.cost[s1] + st.cost[s2]) continue;
+
+                st.deselect(s1);
+                st.deselect(s2);
+                st.select(q);
+
+                bool valid = true;
+                for (int m : st.pi_minterms[s1]) {
+                    if (st.cover_count[m] == 0) { valid = false; break; }
+                }
+                for (int m : st.pi_minterms[s2]) {
+                    if (!valid) break;
+                    if (st.cover_count[m] == 0) valid = false;
+                }
+
+                if (valid) return true;
+
+                st.deselect(q);
+                st.select(s1);
+                st.select(s2);
+            }
+        }
+
+        // 1-swap: q replaces one more expensive PI
+        for (int s : replaceable) {
+            if (st.cost[q] < st.cost[s]) {
+                st.deselect(s);
+                st.select(q);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+}  // namespace
+
+PetrickTerm GreedyCoverSolver::coverClauses(const std::vector<PetrickTerm>& clauses,
+                                            const std::vector<int>& literals) {
+    // Renumber the PIs that appear in the clauses
+    std::vector<int> pi_ids;
+    std::map<int, int> local_of_pi;
+    GreedyState st;
+    st.minterm_pis.resize(clauses.size());
+
+    for (size_t m = 0; m < clauses.size(); m++) {
+        for (int pi : clauses[m]) {
+            auto it = local_of_pi.find(pi);
+            int local;
+            if (it == local_of_pi.end()) {
+                local = pi_ids.size();
+                local_of_pi[pi] = local;
+                pi_ids.push_back(pi);
+                st.pi_minterms.push_back(std::vector<int>());
+            } else {
+                local = it->second;
+            }
+            st.pi_minterms[local].push_back(m);
+            st.minterm_pis[m].push_back(local);
+        }
+    }
+
+    // Cost of a PI: one unit per PI dominates any literal difference
+    long long scale = 1;
+    for (int pi : pi_ids) {
+        scale = std::max<long long>(scale, literals[pi] + 1);
+    }
+    for (int pi : pi_ids) {
+        st.cost.push_back(scale + literals[pi]);
+    }
+
+    st.selected.assign(pi_ids.size(), 0);
+    st.cover_count.assign(clauses.size(), 0);
+
+    // Step 1: Chvátal greedy with a lazy priority queue
+    // Gains only shrink, so a popped entry whose gain is still current is
+    // the best choice; stale entries are pushed back with their new gain
+    struct Entry {
+        long long gain;
+        long long cost;
+        int pi;
+    };
+    auto worse = [](const Entry& a, const Entry& b) {
+        // Compare gain/cost ratios without division; then index for determinism
+        long long lhs = a.gain * b.cost;
+        long long rhs = b.gain * a.cost;
+        if (lhs != rhs) return lhs < rhs;
+        return a.pi > b.pi;
+    };
+    std::priority_queue<Entry, std::vector<Entry>, decltype(worse)> queue(worse);
+
+    for (size_t p = 0; p < pi_ids.size(); p++) {
+        queue.push(Entry{(long long)st.pi_minterms[p].size(), st.cost[p], (int)p});
+    }
+
+    size_t uncovered = clauses.size();
+    while (uncovered > 0 && !queue.empty()) {
+        Entry top = queue.top();
+        queue.pop();
+
+        long long gain = 0;
+        for (int m : st.pi_minterms[top.pi]) {
+            if (st.cover_count[m] == 0) gain++;
+        }
+        if (gain == 0) continue;
+        if (gain != top.gain) {
+            queue.push(Entry{gain, top.cost, top.pi});
+            continue;
+        }
+
+        st.select(top.pi);
+        uncovered -= gain;
+    }
+
+    // Step 2: Redundancy removal
+    removeRedundant(st);
+
+    // Step 3: Local search; every accepted swap strictly lowers the cost
+    while (improveOnce(st)) {
+        removeRedundant(st);
+    }
+
+    PetrickTerm cover;
+    for (size_t p = 0; p < pi_ids.size(); p++) {
+        if (st.selected[p]) cover.insert(pi_ids[p]);
+    }
+    return cover;
+}
+
+// ==================== GreedyCoverSolver Implementation ====================
+
+void GreedyCoverSolver::solve(const std::vector<Implicant>& pis,
+                              const std::vector<int>& minterms,
+                              const std::vector<int>& dont_cares) {
+    essential_pi_indices.clear();
+    additional_pi_indices.clear();
+
+    LOG(SUMMARY) << "\n[Step 4] Greedy Covering (heuristic)\n";
+    chart.build(pis, minterms, dont_cares);
+
+    // Essential PIs are part of every cover
+    for (const auto& epi : chart.findEssentialPIs()) {
+        essential_pi_indices.push_back(epi.pi_index);
+    }
+    LOG(SUMMARY) << "  ✓ Essential PIs: " << essential_pi_indices.size() << "\n";
+
+    std::vector<int> remaining = chart.getRemainingMinterms(essential_pi_indices);
+    LOG(SUMMARY) << "  ✓ Remaining minterms: " << remaining.size() << "\n";
+
+    lower_bound = essential_pi_indices.size();
+    proven = remaining.empty();
+    if (remaining.empty()) {
+        return;
+    }
+
+    std::vector<PetrickTerm> clauses;
+    for (int m : remaining) {
+        std::vector<int> covering = chart.getPIsCovering(m);
+        clauses.push_back(PetrickTerm(covering.begin(), covering.end()));
+    }
+
+    std::vector<int> literals;
+    for (size_t i = 0; i < pis.size(); i++) {
+        literals.push_back(countLiterals(std::vector<int>(1, i)));
+    }
+
+    PetrickTerm cover = coverClauses(clauses, literals);
+    additional_pi_indices.assign(cover.begin(), cover.end());
+
+    lower_bound += BranchAndBoundCover(clauses, literals).computeLowerBound();
+    LOG(SUMMARY) << "  ✓ Heuristic cover: " << additional_pi_indices.size() << " PIs"
+                 << " (lower bound " << (lower_bound - (int)essential_pi_indices.size()) << ")\n";
+}
+
+std::vector<Implicant> GreedyCoverSolver::getMinimalCover() const {
+    std::vector<int> all = essential_pi_indices;
+    all.insert(all.end(), additional_pi_indices.begin(), additional_pi_indices.end());
+    std::sort(all.begin(), all.end());
+
+    std::vector<Implicant> result;
+    for (int idx : all) {
+        result.push_back(chart.getPrimeImplicants()[idx]);
+    }
+    return result;
+}
+
+int GreedyCoverSolver::countLiterals(const std::vector<int>& pis) const {
+    int count = 0;
+    for (int idx : pis) {
+        for (char c : chart.getPrimeImplicants()[idx].value) {
+            if (c != '-') count++;
+        }
+    }
+    return count;
+}
+
+void GreedyCoverSolver::printSolution() const {
+    LOG(SUMMARY) << "\n╔═══════════════════════════════════════════════════════════════╗\n";
+    LOG(SUMMARY) << "║          FINAL COVER (GREEDY HEURISTIC)                       ║\n";
+    LOG(SUMMARY) << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+
+    const auto& all_pis = chart.getPrimeImplicants();
+
+    if (!essential_pi_indices.empty()) {
+        LOG(SUMMARY) << "Essential PIs:\n";
+        for (int idx : essential_pi_indices) {
+            LOG(SUMMARY) << "   PI" << (idx + 1) << ": " << all_pis[idx].value << "\n";
+        }
+        LOG(SUMMARY) << "\n";
+    }
+
+    if (!additional_pi_indices.empty()) {
+        LOG(SUMMARY) << "Additional PIs (greedy + local search):\n";
+        for (int idx : additional_pi_indices) {
+            LOG(SUMMARY) << "   PI" << (idx + 1) << ": " << all_pis[idx].value << "\n";
+        }
+        LOG(SUMMARY) << "\n";
+    }
+
+    std::vector<int> all = essential_pi_indices;
+    all.insert(all.end(), additional_pi_indices.begin(), additional_pi_indices.end());
+    LOG(SUMMARY) << "Total: " << all.size() << " PIs, " << countLiterals(all) << " literals\n";
+    LOG(SUMMARY) << "Lower bound: " << lower_bound << " PIs"
+                 << (proven ? " (proven optimal)" : "") << "\n";
+}
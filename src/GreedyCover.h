@@ -0,0 +1,43 @@
+#pragma once
+#include "CoverSolver.h"
+#include "Petrick.h"
+#include <vector>
+
+// Greedy heuristic covering engine
+// Fast but not necessarily minimal. After the Essential PIs are taken, the
+// rest of the chart is covered in three passes:
+//   1. Chvátal greedy: repeatedly take the PI with the best ratio of newly
+//      covered minterms to cost (cost = one PI plus its literals)
+//   2. Redundancy removal: drop selected PIs whose minterms are all covered
+//      by other selected PIs, most expensive first
+//   3. Local search: 1-swap (replace a PI by a cheaper one) and 2-swap
+//      (replace two PIs by one) until no swap lowers the cost
+class GreedyCoverSolver : public CoverSolver {
+private:
+    PrimeImplicantChart chart;
+    std::vector<int> essential_pi_indices;      // Indices of Essential PIs
+    std::vector<int> additional_pi_indices;     // PIs picked by the heuristic
+    int lower_bound;                            // Disjoint-clause lower bound on PIs
+    bool proven;                                // Essential PIs cover everything (no choice made)
+
+    // Count total literals in a set of PIs
+    int countLiterals(const std::vector<int>& pis) const;
+
+public:
+    GreedyCoverSolver() : lower_bound(0), proven(true) {}
+
+    // Heuristic cover of a set of clauses (one set of PI indices per minterm)
+    // literals: literal count of every PI
+    static PetrickTerm coverClauses(const std::vector<PetrickTerm>& clauses,
+                                    const std::vector<int>& literals);
+
+    // CoverSolver interface
+    void solve(const std::vector<Implicant>& pis,
+               const std::vector<int>& minterms,
+               const std::vector<int>& dont_cares);
+    std::vector<Implicant> getMinimalCover() const;
+    void printSolution() const;
+    bool isProvenOptimal() const { return proven; }
+    int getLowerBound() const { return lower_bound; }
+    const char* getName() const { return "greedy"; }
+};
@@ -0,0 +1,395 @@
+#include "IncrementalMinimizer.h"
+#include "Console.h"
+#include "GreedyCover.h"
+#include "PbSolver.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+const int IncrementalMinimizer::MAX_VARS;
+
+IncrementalMinimizer::IncrementalMinimizer(int num_variables)
+    : num_vars(num_variables), qm(num_variables), points(size_t(1) << num_variables, OFF),
+      next_component_id(0), initialized(false) {
+}
+
+// ==== Cube helpers ====
+
+bool IncrementalMinimizer::cubeContainsPoint(const std::string& cube, int m) const {
+    for (int i = 0; i < num_vars; i++) {
+        char bit = (m >> (num_vars - 1 - i) & 1) ? '1' : '0';
+        if (cube[i] != '-' && cube[i] != bit) return false;
+    }
+    return true;
+}
+
+bool IncrementalMinimizer::cubeContains(const std::string& outer, const std::string& inner) {
+    for (size_t i = 0; i < outer.size(); i++) {
+        if (outer[i] != '-' && outer[i] != inner[i]) return false;
+    }
+    return true;
+}
+
+std::vector<int> IncrementalMinimizer::cubePoints(const std::string& cube) const {
+    std::vector<int> free_bits;
+    int base = 0;
+    for (int i = 0; i < num_vars; i++) {
+        int bit = num_vars - 1 - i;
+        if (cube[i] == '1') base |= 1 << bit;
+        else if (cube[i] == '-') free_bits.push_back(bit);
+    }
+
+    std::vector<int> result;
+    for (int mask = 0; mask < (1 << free_bits.size()); mask++) {
+        int m = base;
+        for (size_t b = 0; b < free_bits.size(); b++) {
+            if (mask & (1 << b)) m |= 1 << free_bits[b];
+        }
+        result.push_back(m);
+    }
+    return result;
+}
+
+bool IncrementalMinimizer::isImplicant(const std::string& cube) const {
+    for (int m : cubePoints(cube)) {
+        if (points[m] == OFF) return false;
+    }
+    return true;
+}
+
+std::vector<std::string> IncrementalMinimizer::primesContaining(int p) const {
+    // Cube around p with the variables of `mask` freed (bit i = variable i)
+    auto cubeOf = [&](int mask) {
+        std::string cube(num_vars, '0');
+        for (int i = 0; i < num_vars; i++) {
+            if (mask >> i & 1) cube[i] = '-';
+            else if (p >> (num_vars - 1 - i) & 1) cube[i] = '1';
+        }
+        return cube;
+    };
+
+    // Implicants around p are closed under fixing variables, so adding
+    // variables in increasing order from implicants reaches all of them
+    std::set<int> implicant_masks;
+    std::vector<int> frontier(1, 0);
+    implicant_masks.insert(0);
+    while (!frontier.empty()) {
+        std::vector<int> next;
+        for (int mask : frontier) {
+            int highest = -1;
+            for (int i = 0; i < num_vars; i++) {
+                if (mask >> i & 1) highest = i;
+            }
+            for (int i = highest + 1; i < num_vars; i++) {
+                int grown = mask | (1 << i);
+                if (isImplicant(cubeOf(grown))) {
+                    implicant_masks.insert(grown);
+                    next.push_back(grown);
+                }
+            }
+        }
+        frontier.swap(next);
+    }
+
+    // Primes: implicants that cannot free one more variable
+    std::vector<std::string> result;
+    for (int mask : implicant_masks) {
+        bool maximal = true;
+        for (int i = 0; i < num_vars && maximal; i++) {
+            if (!(mask >> i & 1) && implicant_masks.count(mask | (1 << i))) maximal = false;
+        }
+        if (maximal) result.push_back(cubeOf(mask));
+    }
+    return result;
+}
+
+// ==== Edits ====
+
+void IncrementalMinimizer::addPrime(const std::string& cube) {
+    if (!primes.insert(cube).second) return;
+    pending.primes_added++;
+    for (int m : cubePoints(cube)) {
+        if (points[m] == ON) {
+            covering[m].insert(cube);
+            dirty_points.insert(m);
+        }
+    }
+}
+
+void IncrementalMinimizer::removePrime(const std::string& cube) {
+    if (!primes.erase(cube)) return;
+    pending.primes_removed++;
+    for (int m : cubePoints(cube)) {
+        if (points[m] == ON) {
+            covering[m].erase(cube);
+            dirty_points.insert(m);
+        }
+    }
+}
+
+void IncrementalMinimizer::setPoint(int m, PointState state) {
+    PointState old = (PointState)points[m];
+    if (old == state) return;
+
+    dirty_points.insert(m);
+    if (old == ON) covering.erase(m);
+    points[m] = state;
+    if (!initialized) return;  // The first minimize() computes everything
+
+    if (old == OFF) {
+        // m joins on + dc: the primes through m take over the ones they contain
+        std::vector<std::string> fresh = primesContaining(m);
+        std::vector<std::string> dropped;
+        for (const auto& prime : primes) {
+            for (const auto& cube : fresh) {
+                if (cubeContains(cube, prime)) {
+                    dropped.push_back(prime);
+                    break;
+                }
+            }
+        }
+        for (const auto& prime : dropped) removePrime(prime);
+        for (const auto& cube : fresh) addPrime(cube);
+    } else if (state == OFF) {
+        // m leaves on + dc: drop the primes through m, then try their
+        // sub-cubes that avoid m
+        std::vector<std::string> dropped;
+        for (const auto& prime : primes) {
+            if (cubeContainsPoint(prime, m)) dropped.push_back(prime);
+        }
+        for (const auto& prime : dropped) removePrime(prime);
+
+        std::set<std::string> candidates;
+        for (const auto& prime : dropped) {
+            for (int i = 0; i < num_vars; i++) {
+                if (prime[i] != '-') continue;
+                std::string cube = prime;
+                cube[i] = (m >> (num_vars - 1 - i) & 1) ? '0' : '1';
+                candidates.insert(cube);
+            }
+        }
+        for (const auto& cube : candidates) {
+            bool prime = true;
+            for (const auto& other : primes) {
+                if (cubeContains(other, cube)) { prime = false; break; }
+            }
+            for (const auto& other : candidates) {
+                if (!prime) break;
+                if (other != cube && cubeContains(other, cube)) prime = false;
+            }
+            if (prime) addPrime(cube);
+        }
+    } else if (state == ON) {
+        // Don't care -> on-set: same primes, new chart column
+        for (const auto& prime : primes) {
+            if (cubeContainsPoint(prime, m)) covering[m].insert(prime);
+        }
+    }
+}
+
+void IncrementalMinimizer::setFunction(const std::vector<int>& minterms,
+                                       const std::vector<int>& dont_cares) {
+    std::fill(points.begin(), points.end(), OFF);
+    for (int d : dont_cares) points[d] = DC;
+    for (int m : minterms) points[m] = ON;
+    initialized = false;
+}
+
+void IncrementalMinimizer::addMinterm(int m) { setPoint(m, ON); }
+
+void IncrementalMinimizer::removeMinterm(int m) {
+    if (points[m] == ON) setPoint(m, OFF);
+}
+
+void IncrementalMinimizer::addDontCare(int m) { setPoint(m, DC); }
+
+void IncrementalMinimizer::removeDontCare(int m) {
+    if (points[m] == DC) setPoint(m, OFF);
+}
+
+// ==== Covering ====
+
+std::vector<std::string> IncrementalMinimizer::solveComponent(const std::vector<int>& minterms) {
+    std::set<std::string> cubes;
+    for (int m : minterms) {
+        cubes.insert(covering[m].begin(), covering[m].end());
+    }
+    std::vector<std::string> local(cubes.begin(), cubes.end());
+
+    std::ostringstream signature;
+    for (const auto& cube : local) signature << cube << " ";
+    signature << "|";
+    for (int m : minterms) signature << " " << m;
+
+    auto memo = solved_memo.find(signature.str());
+    if (memo != solved_memo.end()) {
+        pending.memo_hits++;
+        return memo->second;
+    }
+
+    // Weight = one prime (worth more than all literals together) + its literals
+    std::map<std::string, int> index;
+    std::vector<int> literals;
+    long long scale = 1;
+    for (size_t i = 0; i < local.size(); i++) {
+        index[local[i]] = i;
+        literals.push_back(num_vars - std::count(local[i].begin(), local[i].end(), '-'));
+        scale += literals.back();
+    }
+    std::vector<long long> weights;
+    for (int lits : literals) weights.push_back(scale + lits);
+
+    PbOptimizer optimizer(weights);
+    std::vector<PetrickTerm> clauses;
+    for (int m : minterms) {
+        PetrickTerm clause;
+        std::vector<int> lits;
+        for (const auto& cube : covering[m]) {
+            clause.insert(index[cube]);
+            lits.push_back(PbOptimizer::positive(index[cube]));
+        }
+        clauses.push_back(clause);
+        optimizer.addClause(lits);
+    }
+
+    // Start from the greedy cover; the optimizer only looks for cheaper ones
+    std::vector<int> best;
+    long long best_cost = 0;
+    for (int i : GreedyCoverSolver::coverClauses(clauses, literals)) {
+        best.push_back(i);
+        best_cost += weights[i];
+    }
+    optimizer.minimize(best_cost - 1, best, best_cost, CoverBudget());
+
+    std::vector<std::string> cover;
+    for (int i : best) cover.push_back(local[i]);
+    pending.components_solved++;
+    solved_memo[signature.str()] = cover;
+    return cover;
+}
+
+void IncrementalMinimizer::minimize() {
+    if (!initialized) {
+        std::vector<int> minterms = getMinterms();
+        qm.findPrimeImplicants(minterms, getDontCares());
+
+        primes.clear();
+        covering.clear();
+        component_of.clear();
+        components.clear();
+        initialized = true;
+
+        for (const auto& pi : qm.getPrimeImplicants()) addPrime(pi.value);
+        dirty_points.insert(minterms.begin(), minterms.end());
+    }
+
+    // Components with a changed minterm are solved again
+    std::set<int> stale;
+    for (int m : dirty_points) {
+        auto it = component_of.find(m);
+        if (it != component_of.end()) stale.insert(it->second);
+    }
+
+    std::vector<int> seeds;
+    for (int m : dirty_points) {
+        if (points[m] == ON) seeds.push_back(m);
+    }
+    auto dropComponent = [&](int id) {
+        for (int m : components[id].minterms) {
+            component_of.erase(m);
+            if (points[m] == ON) seeds.push_back(m);
+        }
+        components.erase(id);
+    };
+    for (int id : stale) dropComponent(id);
+    dirty_points.clear();
+
+    // Regroup the seeds into components, absorbing untouched components
+    // that a changed prime now links to them
+    // (dropComponent appends to seeds, hence the index loop)
+    std::set<int> visited;
+    for (size_t s = 0; s < seeds.size(); s++) {
+        int seed = seeds[s];
+        if (visited.count(seed)) continue;
+
+        std::vector<int> minterms;
+        std::vector<int> queue(1, seed);
+        visited.insert(seed);
+        while (!queue.empty()) {
+            int m = queue.back();
+            queue.pop_back();
+            minterms.push_back(m);
+
+            for (const auto& cube : covering[m]) {
+                for (int other : cubePoints(cube)) {
+                    if (points[other] != ON || visited.count(other)) continue;
+                    auto it = component_of.find(other);
+                    if (it != component_of.end()) dropComponent(it->second);
+                    visited.insert(other);
+                    queue.push_back(other);
+                }
+            }
+        }
+
+        std::sort(minterms.begin(), minterms.end());
+        Component component;
+        component.minterms = minterms;
+        component.cover = solveComponent(minterms);
+
+        int id = next_component_id++;
+        for (int m : minterms) component_of[m] = id;
+        components[id] = component;
+    }
+
+    pending.components_reused = components.size() - pending.components_solved - pending.memo_hits;
+    last = pending;
+    pending = UpdateStats();
+}
+
+// ==== Results ====
+
+std::vector<Implicant> IncrementalMinimizer::getCover() const {
+    std::vector<Implicant> cover;
+    for (const auto& entry : components) {
+        for (const auto& cube : entry.second.cover) {
+            std::set<int> minterms;
+            for (int m : cubePoints(cube)) minterms.insert(m);
+            cover.push_back(Implicant(cube, minterms));
+        }
+    }
+
+    // QuineMcCluskey's column order: fewer '-' first, then fewer 1's
+    std::sort(cover.begin(), cover.end(), [](const Implicant& a, const Implicant& b) {
+        int dash_a = std::count(a.value.begin(), a.value.end(), '-');
+        int dash_b = std::count(b.value.begin(), b.value.end(), '-');
+        if (dash_a != dash_b) return dash_a < dash_b;
+        int ones_a = std::count(a.value.begin(), a.value.end(), '1');
+        int ones_b = std::count(b.value.begin(), b.value.end(), '1');
+        if (ones_a != ones_b) return ones_a < ones_b;
+        return a.minterms < b.minterms;
+    });
+    return cover;
+}
+
+std::vector<int> IncrementalMinimizer::getMinterms() const {
+    std::vector<int> result;
+    for (size_t m = 0; m < points.size(); m++) {
+        if (points[m] == ON) result.push_back(m);
+    }
+    return result;
+}
+
+std::vector<int> IncrementalMinimizer::getDontCares() const {
+    std::vector<int> result;
+    for (size_t m = 0; m < points.size(); m++) {
+        if (points[m] == DC) result.push_back(m);
+    }
+    return result;
+}
+
+void IncrementalMinimizer::printUpdate() const {
+    LOG(SUMMARY) << "primes +" << last.primes_added << " -" << last.primes_removed
+                 << " (" << primes.size() << "), components solved " << last.components_solved
+                 << ", memoized " << last.memo_hits << ", kept " << last.components_reused
+                 << " (" << components.size() << ")";
+}
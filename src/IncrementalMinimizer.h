@@ -0,0 +1,106 @@
+#pragma once
+#include "QuineMcCluskey.h"
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Exact minimizer that follows small edits of the function
+// The first minimize() runs QuineMcCluskey and solves every chart
+// component; after that, on-set and don't-care minterms can be added and
+// removed, and the next minimize() only updates what the edits touched.
+//
+// Primes, when point p joins on + dc (F):
+//   the new primes are the maximal cubes of F containing p; old primes
+//   contained in one of them are no longer prime, the rest stay.
+// Primes, when p leaves F:
+//   the primes containing p are dropped; every new prime is one of them
+//   with a free variable fixed away from p, so only those candidates are
+//   checked (kept when no other prime or candidate contains them).
+// Moving a point between the on-set and the don't cares keeps the primes.
+//
+// Covering: the chart splits into components (minterms linked by shared
+// primes). Only components with a changed minterm or prime are solved
+// again (exactly, with PbOptimizer); the others keep their cover.
+// Solved components are also memoized, so undoing an edit is free.
+class IncrementalMinimizer {
+public:
+    static const int MAX_VARS = 20;
+
+private:
+    enum PointState { OFF = 0, ON = 1, DC = 2 };
+
+    struct UpdateStats {
+        int primes_added = 0;
+        int primes_removed = 0;
+        int components_solved = 0;
+        int memo_hits = 0;
+        int components_reused = 0;
+    };
+
+    struct Component {
+        std::vector<int> minterms;             // Sorted on-set minterms
+        std::vector<std::string> cover;        // Selected primes
+    };
+
+    int num_vars;
+    QuineMcCluskey qm;
+    std::vector<char> points;                  // PointState of every minterm
+    std::set<std::string> primes;
+    std::map<int, std::set<std::string>> covering;  // On-set minterm -> primes containing it
+
+    std::map<int, int> component_of;           // On-set minterm -> component id
+    std::map<int, Component> components;
+    int next_component_id;
+    std::map<std::string, std::vector<std::string>> solved_memo;  // Component signature -> cover
+
+    bool initialized;
+    std::set<int> dirty_points;                // Minterms whose chart column changed
+
+    UpdateStats pending;                       // Since the last minimize()
+    UpdateStats last;                          // Of the last minimize()
+
+    // Cube helpers on "10-1" strings (first character = MSB)
+    bool cubeContainsPoint(const std::string& cube, int m) const;
+    static bool cubeContains(const std::string& outer, const std::string& inner);
+    std::vector<int> cubePoints(const std::string& cube) const;
+    bool isImplicant(const std::string& cube) const;
+
+    // Maximal cubes of on + dc containing minterm p
+    std::vector<std::string> primesContaining(int p) const;
+
+    void addPrime(const std::string& cube);
+    void removePrime(const std::string& cube);
+
+    // Change the state of one minterm and update the primes
+    void setPoint(int m, PointState state);
+
+    // Exact cover of one component (fewest primes, then fewest literals)
+    std::vector<std::string> solveComponent(const std::vector<int>& minterms);
+
+public:
+    explicit IncrementalMinimizer(int num_variables);
+
+    // Initial function; minimize() does the full computation once
+    void setFunction(const std::vector<int>& minterms, const std::vector<int>& dont_cares);
+
+    // Edits (take effect at the next minimize())
+    void addMinterm(int m);        // Into the on-set (from off or don't care)
+    void removeMinterm(int m);     // On-set -> off
+    void addDontCare(int m);       // Off or on-set -> don't care
+    void removeDontCare(int m);    // Don't care -> off
+
+    // Bring the cover up to date with the edits so far
+    void minimize();
+
+    // Current minimum cover, ordered like QuineMcCluskey's columns
+    std::vector<Implicant> getCover() const;
+
+    std::vector<int> getMinterms() const;
+    std::vector<int> getDontCares() const;
+    int getNumPrimes() const { return primes.size(); }
+    int getNumComponents() const { return components.size(); }
+
+    // One line about the last minimize()
+    void printUpdate() const;
+};
@@ -0,0 +1,188 @@
+#include "MemTrack.h"
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+// Constant-initialized, so allocations before main() are safe to count
+static thread_local int thread_stage = MemTrack::OTHER;
+
+namespace {
+
+struct Counters {
+    std::atomic<long long> allocations;
+    std::atomic<long long> frees;
+    std::atomic<long long> bytes_allocated;
+    std::atomic<long long> live_bytes;
+    std::atomic<long long> peak_live_bytes;
+};
+
+// Zero-initialized static storage, usable before any constructor runs
+Counters stage_counters[MemTrack::NUM_STAGES];
+std::atomic<long long> total_peak_bytes;
+
+}  // namespace
+
+#ifdef MEMTRACK
+
+static std::atomic<long long> total_live_bytes;
+
+static void raisePeak(std::atomic<long long>& peak, long long value) {
+    long long seen = peak.load(std::memory_order_relaxed);
+    while (value > seen && !peak.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+// Every block starts with a header holding its size and stage; 16 bytes
+// keep the block as aligned as malloc's
+struct BlockHeader {
+    size_t size;
+    int stage;
+};
+static const size_t HEADER_BYTES = 16;
+static_assert(sizeof(BlockHeader) <= HEADER_BYTES, "block header too large");
+
+static void* trackedAlloc(size_t size) {
+    char* block = static_cast<char*>(std::malloc(size + HEADER_BYTES));
+    if (!block) return nullptr;
+
+    int stage = thread_stage;
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+    header->size = size;
+    header->stage = stage;
+
+    Counters& counters = stage_counters[stage];
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+    raisePeak(counters.peak_live_bytes,
+              counters.live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+    raisePeak(total_peak_bytes, total_live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+    return block + HEADER_BYTES;
+}
+
+static void trackedFree(void* pointer) {
+    if (!pointer) return;
+    char* block = static_cast<char*>(pointer) - HEADER_BYTES;
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+
+    Counters& counters = stage_counters[header->stage];
+    counters.frees.fetch_add(1, std::memory_order_relaxed);
+    counters.live_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+    total_live_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+    std::free(block);
+}
+
+void* operator new(size_t size) {
+    void* pointer = trackedAlloc(size);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void* operator new[](size_t size) {
+    void* pointer = trackedAlloc(size);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return trackedAlloc(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    trackedFree(pointer);
+}
+
+bool MemTrack::enabled() {
+    return true;
+}
+
+#else
+
+bool MemTrack::enabled() {
+    return false;
+}
+
+#endif
+
+const char* MemTrack::stageName(Stage stage) {
+    static const char* names[NUM_STAGES] = {
+        "other", "parse", "minterms", "primes", "chart", "petrick", "cover", "write"
+    };
+    return names[stage];
+}
+
+MemTrack::StageCounts MemTrack::get(Stage stage) {
+    const Counters& counters = stage_counters[stage];
+    StageCounts counts;
+    counts.allocations = counters.allocations.load();
+    counts.frees = counters.frees.load();
+    counts.bytes_allocated = counters.bytes_allocated.load();
+    counts.live_bytes = counters.live_bytes.load();
+    counts.peak_live_bytes = counters.peak_live_bytes.load();
+    return counts;
+}
+
+long long MemTrack::peakLiveBytes() {
+    return total_peak_bytes.load();
+}
+
+void MemTrack::print(std::ostream& out) {
+    std::ios::fmtflags flags = out.flags();
+    out << "\n[Memory] Heap allocations by stage" << std::endl;
+    out << "  " << std::left << std::setw(10) << "stage" << std::right << std::setw(12) << "allocs"
+        << std::setw(12) << "frees" << std::setw(15) << "allocated KB" << std::setw(14) << "peak live KB"
+        << std::setw(10) << "live KB" << std::endl;
+    for (int s = 0; s < NUM_STAGES; s++) {
+        StageCounts counts = get(Stage(s));
+        if (counts.allocations == 0) continue;
+        out << "  " << std::left << std::setw(10) << stageName(Stage(s)) << std::right
+            << std::setw(12) << counts.allocations << std::setw(12) << counts.frees
+            << std::setw(15) << counts.bytes_allocated / 1024
+            << std::setw(14) << counts.peak_live_bytes / 1024
+            << std::setw(10) << counts.live_bytes / 1024 << std::endl;
+    }
+    out << "  Peak live heap: " << peakLiveBytes() / 1024 << " KB" << std::endl;
+    out.flags(flags);
+}
+
+void MemTrack::writeJsonMember(std::ostream& out) {
+    out << "\"memory\": {\"peak_live_bytes\": " << peakLiveBytes() << ", \"stages\": {";
+    bool first = true;
+    for (int s = 0; s < NUM_STAGES; s++) {
+        StageCounts counts = get(Stage(s));
+        if (counts.allocations == 0) continue;
+        out << (first ? "" : ", ") << "\"" << stageName(Stage(s)) << "\": {\"allocations\": "
+            << counts.allocations << ", \"frees\": " << counts.frees
+            << ", \"bytes_allocated\": " << counts.bytes_allocated
+            << ", \"peak_live_bytes\": " << counts.peak_live_bytes
+            << ", \"live_bytes\": " << counts.live_bytes << "}";
+        first = false;
+    }
+    out << "}}";
+}
+
+MemoryStage::MemoryStage(MemTrack::Stage stage) : previous(thread_stage), active(true) {
+    thread_stage = stage;
+}
+
+void MemoryStage::end() {
+    if (!active) return;
+    active = false;
+    thread_stage = previous;
+}
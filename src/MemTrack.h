@@ -0,0 +1,56 @@
+#pragma once
+#include <ostream>
+
+// Heap allocations charged to the pipeline stages (make memtrack)
+// The memtrack build (-DMEMTRACK, binary minimize_memtrack) replaces the
+// global operator new/delete: every block records the stage that was
+// active on the allocating thread, and its free is credited back to that
+// stage. So each stage gets its allocation count, bytes allocated and the
+// high-water mark of its live bytes, wherever the blocks are freed later.
+// In the normal build MemoryStage only sets a thread-local and nothing is
+// counted.
+class MemTrack {
+public:
+    enum Stage { OTHER, PARSE, MINTERMS, PRIMES, CHART, PETRICK, COVER, WRITE, NUM_STAGES };
+
+    struct StageCounts {
+        long long allocations = 0;
+        long long frees = 0;
+        long long bytes_allocated = 0;       // Total over all allocations
+        long long live_bytes = 0;            // Allocated by this stage, not freed yet
+        long long peak_live_bytes = 0;       // High-water mark of live_bytes
+    };
+
+    // Was this build compiled with the tracking allocator?
+    static bool enabled();
+
+    static const char* stageName(Stage stage);
+    static StageCounts get(Stage stage);
+
+    // High-water mark of all live heap bytes
+    static long long peakLiveBytes();
+
+    // Table of all stages
+    static void print(std::ostream& out);
+
+    // The member "memory" of a JSON object (without the braces)
+    static void writeJsonMember(std::ostream& out);
+};
+
+// Charge the calling thread's allocations to a stage for one scope, then
+// return to the stage that was active before
+class MemoryStage {
+private:
+    int previous;
+    bool active;
+
+public:
+    explicit MemoryStage(MemTrack::Stage stage);
+    ~MemoryStage() { end(); }
+
+    // Return to the previous stage before the scope ends; later calls do nothing
+    void end();
+
+    MemoryStage(const MemoryStage&) = delete;
+    MemoryStage& operator=(const MemoryStage&) = delete;
+};
@@ -0,0 +1,127 @@
+#include "MinimizeLib.h"
+#include "Console.h"
+#include "PlaParser.h"
+#include "PlaWriter.h"
+
+// Minterms are ints
+static const int MAX_MINTERM_INPUTS = 30;
+
+static bool isCube(const std::string& cube, int num_inputs) {
+    if ((int)cube.size() != num_inputs) return false;
+    for (char c : cube) {
+        if (c != '0' && c != '1' && c != '-') return false;
+    }
+    return true;
+}
+
+static std::string mintermCube(int minterm, int num_inputs) {
+    std::string cube(num_inputs, '0');
+    for (int i = 0; i < num_inputs; i++) {
+        if ((minterm >> (num_inputs - 1 - i)) & 1) cube[i] = '1';
+    }
+    return cube;
+}
+
+// Run the flow on the product terms; the console is silenced for the call
+static MinimizedCover minimizeTerms(int num_inputs, const std::vector<ProductTerm>& terms,
+                                    const MinimizerOptions& options) {
+    MinimizedCover cover;
+    std::string error = checkOptions(options);
+    if (error.empty() && (!options.edits_file.empty() || options.list_optimal)) {
+        error = "Edits and listing all covers are not available in the library";
+    }
+    // The sharded generator forks and writes its shards to temporary files
+    if (error.empty() && options.prime_engine == "sharded") {
+        error = "The sharded prime generator is not available in the library";
+    }
+    if (!error.empty()) {
+        cover.error = error;
+        return cover;
+    }
+
+    std::ostream quiet(nullptr);
+    ScopedConsole silence(&quiet);
+    ScopedLogLevel no_tracing(LogLevel::QUIET);
+
+    PlaParser parser;
+    parser.setFunction(num_inputs, terms);
+    PlaWriter writer(num_inputs, parser.getInputNames(), "F");
+
+    // No cache: the library does no file I/O
+    ResultCache no_cache("");
+    std::string cache_key;
+    MinimizeResult result;
+    try {
+        if (!minimizeParsed(options, parser, writer, no_cache, cache_key, result)) {
+            cover.error = result.error;
+            return cover;
+        }
+    } catch (const std::exception& e) {
+        cover.error = std::string("Exception: ") + e.what();
+        return cover;
+    }
+
+    for (const auto& imp : writer.getMinimalCover()) {
+        cover.cubes.push_back(imp.value);
+    }
+    cover.literals = writer.getTotalLiterals();
+    cover.proven_optimal = writer.isProvenOptimal();
+    cover.lower_bound = writer.getLowerBound();
+    cover.generator = writer.getGenerator();
+    cover.ok = true;
+    return cover;
+}
+
+MinimizedCover minimizeMinterms(int num_inputs, const std::vector<int>& on_set,
+                                const std::vector<int>& dont_cares,
+                                const MinimizerOptions& options) {
+    MinimizedCover cover;
+    if (num_inputs < 1 || num_inputs > MAX_MINTERM_INPUTS) {
+        cover.error = "Minterm input needs 1 to " + std::to_string(MAX_MINTERM_INPUTS) + " inputs";
+        return cover;
+    }
+
+    std::vector<ProductTerm> terms;
+    terms.reserve(on_set.size() + dont_cares.size());
+    for (int pass = 0; pass < 2; pass++) {
+        const std::vector<int>& points = (pass == 0) ? on_set : dont_cares;
+        for (int m : points) {
+            if (m < 0 || m >= (1 << num_inputs)) {
+                cover.error = "Minterm out of range: " + std::to_string(m);
+                return cover;
+            }
+            terms.push_back({mintermCube(m, num_inputs), pass == 0 ? "1" : "-"});
+        }
+    }
+    return minimizeTerms(num_inputs, terms, options);
+}
+
+MinimizedCover minimizeCubes(int num_inputs, const std::vector<std::string>& on_cubes,
+                             const std::vector<std::string>& dc_cubes,
+                             const MinimizerOptions& options) {
+    MinimizedCover cover;
+    if (num_inputs < 1) {
+        cover.error = "A function needs at least one input";
+        return cover;
+    }
+    // The exact engine expands the cubes into int minterms
+    if (options.engine != "espresso" && num_inputs > MAX_MINTERM_INPUTS) {
+        cover.error = "The exact engine takes at most " + std::to_string(MAX_MINTERM_INPUTS) +
+                      " inputs (engine \"espresso\" takes more)";
+        return cover;
+    }
+
+    std::vector<ProductTerm> terms;
+    terms.reserve(on_cubes.size() + dc_cubes.size());
+    for (int pass = 0; pass < 2; pass++) {
+        const std::vector<std::string>& cubes = (pass == 0) ? on_cubes : dc_cubes;
+        for (const auto& cube : cubes) {
+            if (!isCube(cube, num_inputs)) {
+                cover.error = "Malformed cube for " + std::to_string(num_inputs) + " inputs: " + cube;
+                return cover;
+            }
+            terms.push_back({cube, pass == 0 ? "1" : "-"});
+        }
+    }
+    return minimizeTerms(num_inputs, terms, options);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Minimizer.h"
+#include <string>
+#include <vector>
+
+// In-memory library API (make lib: libminimize.a, libminimize.so)
+// Minimizes a single-output function given as minterms or as cubes and
+// returns the cover, for programs that embed the minimizer instead of
+// running it on files. Nothing is printed and no file is read or written.
+// The options are those of the command line (engines, budget, threads);
+// edits_file, list_optimal and the sharded prime engine (which forks
+// worker processes) do not apply. Calls from different threads
+// may run at once.
+//
+// Input i of minterm m is bit (num_inputs - 1 - i) of m, as in PLA files:
+//   MinimizedCover f = minimizeMinterms(3, {3, 5, 6, 7}, {});
+//   // f.cubes == {"-11", "1-1", "11-"}
+
+// A minimized cover
+struct MinimizedCover {
+    bool ok = false;
+    std::string error;                   // Why the call failed
+    std::vector<std::string> cubes;      // Product terms: '0', '1' or '-' per input
+    int literals = 0;
+    bool proven_optimal = false;
+    int lower_bound = 0;                 // Lower bound on product terms when not proven
+    std::string generator;               // Method that produced the cover
+};
+
+// On-set and don't-care minterms (inputs: at most 30)
+MinimizedCover minimizeMinterms(int num_inputs, const std::vector<int>& on_set,
+                                const std::vector<int>& dont_cares,
+                                const MinimizerOptions& options = MinimizerOptions());
+
+// On-set and don't-care cubes ("1-0", one character per input)
+// (inputs: at most 30, unless options.engine is "espresso")
+MinimizedCover minimizeCubes(int num_inputs, const std::vector<std::string>& on_cubes,
+                             const std::vector<std::string>& dc_cubes,
+                             const MinimizerOptions& options = MinimizerOptions());
@@ -0,0 +1,594 @@
+#include "Minimizer.h"
+#include "Console.h"
+#include "PlaParser.h"
+#include "QuineMcCluskey.h"
+#include "Petrick.h"
+#include "CoverSolver.h"
+#include "CoverEnumerator.h"
+#include "CoverVerifier.h"
+#include "Planner.h"
+#include "PlaWriter.h"
+#include "Espresso.h"
+#include "Consensus.h"
+#include "ShardedPrimes.h"
+#include "NpTable.h"
+#include "IncrementalMinimizer.h"
+#include "MemTrack.h"
+#include "Stats.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <sys/resource.h>
+#include <fstream>
+#include <sstream>
+
+typedef std::chrono::steady_clock Clock;
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::string checkOptions(const MinimizerOptions& options) {
+    if (options.engine != "qm" && options.engine != "espresso") {
+        return "Unknown minimizer: " + options.engine;
+    }
+    if (options.prime_engine != "auto" && options.prime_engine != "qm" &&
+        options.prime_engine != "consensus" && options.prime_engine != "sharded") {
+        return "Unknown prime generator: " + options.prime_engine;
+    }
+    if (options.cover_engine != "auto" && !createCoverSolver(options.cover_engine)) {
+        return "Unknown covering engine: " + options.cover_engine;
+    }
+    return "";
+}
+
+static int countLiterals(const std::vector<Implicant>& cover) {
+    int count = 0;
+    for (const auto& imp : cover) {
+        for (char c : imp.value) {
+            if (c != '-') count++;
+        }
+    }
+    return count;
+}
+
+// "# Generated by" line of the solver path, e.g. "Quine-McCluskey + Petrick's Algorithm"
+static std::string describeGenerator(const std::string& prime_engine, const std::string& solver) {
+    std::string primes = prime_engine == "consensus" ? "Iterated consensus"
+                       : prime_engine == "sharded" ? "Sharded Quine-McCluskey"
+                       : "Quine-McCluskey";
+    std::string cover = solver == "greedy" ? "greedy set cover"
+                      : solver == "pb" ? "pseudo-Boolean solver"
+                      : "Petrick's Algorithm";
+    return primes + " + " + cover;
+}
+
+// Write the result (to output_text if given, else to the file output_pla) and
+// report its size; a non-empty cache_key also stores the result in the cache
+static bool writeOutput(PlaWriter& writer, const std::string& output_pla, std::ostream* output_text,
+                        ResultCache& cache, const std::string& cache_key,
+                        MinimizeResult& result) {
+    if (!(output_text ? writer.write(*output_text) : writer.write(output_pla))) {
+        result.error = "Failed to write output file";
+        return false;
+    }
+    LOG(SUMMARY) << "  ✓ Successfully wrote to " << output_pla << std::endl;
+    LOG(SUMMARY) << "  ✓ Product terms: " << writer.getNumProductTerms() << std::endl;
+    LOG(SUMMARY) << "  ✓ Total literals: " << writer.getTotalLiterals() << std::endl;
+
+    if (cache.isEnabled()) {
+        if (!cache_key.empty()) {
+            CachedResult cached;
+            cached.num_inputs = writer.getNumInputs();
+            for (const auto& imp : writer.getMinimalCover()) {
+                cached.cubes.push_back(imp.value);
+            }
+            cached.proven_optimal = writer.isProvenOptimal();
+            cached.lower_bound = writer.getLowerBound();
+            cached.generator = writer.getGenerator();
+            if (!cache.store(cache_key, cached)) {
+                LOG(SUMMARY) << "  ✗ Failed to store the result in the cache" << std::endl;
+            }
+        }
+        cache.printCounters();
+    }
+
+    LOG(SUMMARY) << "\n====================================" << std::endl;
+    LOG(SUMMARY) << "  Minimization Complete!" << std::endl;
+    LOG(SUMMARY) << "====================================" << std::endl;
+
+    result.ok = true;
+    result.product_terms = writer.getNumProductTerms();
+    result.literals = writer.getTotalLiterals();
+    result.proven_optimal = writer.isProvenOptimal();
+    return true;
+}
+
+// Apply an edit file to an incremental minimizer, re-minimizing after each line
+// Lines: "on M..." (into the on-set), "dc M..." (don't care), "off M..."; '#' starts a comment
+static bool applyEdits(const std::string& filename, int num_inputs,
+                       IncrementalMinimizer& minimizer, std::string& error) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        error = "Cannot open edit file " + filename;
+        return false;
+    }
+
+    std::string line;
+    int edit_number = 0;
+    while (std::getline(file, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string action;
+        if (!(fields >> action)) continue;
+        if (action != "on" && action != "dc" && action != "off") {
+            error = "Unknown edit: " + line;
+            return false;
+        }
+
+        std::string token;
+        while (fields >> token) {
+            // Whole numbers only: a stray token must not end the line silently
+            if (token.size() > 9 ||
+                token.find_first_not_of("0123456789") != std::string::npos) {
+                error = "Bad minterm: " + token;
+                return false;
+            }
+            int m = std::stoi(token);
+            if (m >= (1 << num_inputs)) {
+                error = "Minterm out of range: " + std::to_string(m);
+                return false;
+            }
+            if (action == "on") {
+                minimizer.addMinterm(m);
+            } else if (action == "dc") {
+                minimizer.addDontCare(m);
+            } else {
+                minimizer.removeMinterm(m);
+                minimizer.removeDontCare(m);
+            }
+        }
+
+        minimizer.minimize();
+        std::vector<Implicant> cover = minimizer.getCover();
+        edit_number++;
+        LOG(SUMMARY) << "  ✓ Edit " << edit_number << " (" << line << "): " << cover.size()
+                     << " product terms, " << countLiterals(cover) << " literals; ";
+        minimizer.printUpdate();
+        LOG(SUMMARY) << std::endl;
+    }
+    return true;
+}
+
+// Steps 2 on of the flow: cache lookup, then one of the minimization paths
+bool minimizeParsed(const MinimizerOptions& options, const PlaParser& parser,
+                    PlaWriter& writer, ResultCache& cache, std::string& cache_key,
+                    MinimizeResult& result) {
+    // Every engine indexes its arrays by cube position
+    if (parser.getNumInputs() < 1 || parser.getNumInputs() > Cube::MAX_VARS) {
+        result.error = "A function needs 1 to " + std::to_string(Cube::MAX_VARS) + " inputs.";
+        return false;
+    }
+    for (const auto& term : parser.getProductTerms()) {
+        if ((int)term.cube.size() != parser.getNumInputs()) {
+            result.error = "Cube \"" + term.cube + "\" does not have " +
+                           std::to_string(parser.getNumInputs()) + " inputs.";
+            return false;
+        }
+    }
+
+    // Limits count from the start of this run
+    CoverBudget budget = options.budget;
+    budget.begin();
+
+    std::unique_ptr<CoverSolver> solver;
+    if (options.cover_engine != "auto") {
+        solver = createCoverSolver(options.cover_engine);
+    }
+
+    // The exact path expands all 2^inputs points of the cubes into ints
+    if (options.engine == "qm" && parser.getNumInputs() > options.max_minterm_inputs) {
+        result.error = "The exact engine takes at most " +
+                       std::to_string(options.max_minterm_inputs) +
+                       " inputs; use the espresso engine for more.";
+        return false;
+    }
+
+    // Minterms are needed by the exact path and for the cache key
+    std::vector<int> minterms, dont_cares;
+    if (options.engine == "qm" || (cache.isEnabled() &&
+                                   parser.getNumInputs() <= ResultCache::MAX_MINTERM_VARS)) {
+        ScopedTimer minterm_timer("minterms");
+        MemoryStage minterm_stage(MemTrack::MINTERMS);
+        minterms = parser.getMinterms();
+        dont_cares = parser.getDontCares();
+    }
+
+    // Result cache: a stored result skips all computation
+    // Not with edits: the output is the edited function, which the key does not describe
+    cache_key.clear();
+    if (cache.isEnabled() && options.edits_file.empty()) {
+        // Every option that can change the written cover: the engines, and the
+        // limits (a search cut short may settle on another minimum cover)
+        std::ostringstream key_options;
+        key_options << "engine " << options.engine << " primes " << options.prime_engine
+                    << " cover " << options.cover_engine
+                    << " all-optimal " << (options.list_optimal ? 1 : 0)
+                    << " time " << options.budget.time_limit_seconds
+                    << " memory " << options.budget.memory_limit_mb;
+        if (parser.getNumInputs() <= ResultCache::MAX_MINTERM_VARS) {
+            cache_key = ResultCache::problemKey(parser.getNumInputs(), minterms, dont_cares,
+                                                key_options.str());
+        } else {
+            cache_key = ResultCache::problemKey(parser.getNumInputs(), parser.getProductTerms(),
+                                                key_options.str());
+        }
+
+        LOG(SUMMARY) << "\n[Cache] Result Cache" << std::endl;
+        LOG(SUMMARY) << "  ✓ Key: " << cache_key << std::endl;
+
+        CachedResult cached;
+        if (!options.list_optimal && cache.load(cache_key, cached) &&
+            cached.num_inputs == parser.getNumInputs()) {
+            LOG(SUMMARY) << "  ✓ Hit: " << cached.cubes.size() << " product terms" << std::endl;
+
+            std::vector<Implicant> cover;
+            for (const auto& cube : cached.cubes) {
+                cover.push_back(Implicant(cube, std::set<int>()));
+            }
+
+            LOG(SUMMARY) << "\n[Step 2] Write Output PLA" << std::endl;
+            writer.setMinimalCover(cover);
+            writer.setGenerator(cached.generator);
+            writer.setOptimality(cached.proven_optimal, cached.lower_bound);
+            cache_key.clear();
+            return true;
+        }
+        LOG(SUMMARY) << "  ✓ Miss: minimizing" << std::endl;
+    }
+
+    // Heuristic path: minimize the cubes directly, no minterms
+    if (options.engine == "espresso") {
+        ScopedTimer cover_timer("cover", &result.cover_seconds);
+        MemoryStage cover_stage(MemTrack::COVER);
+        EspressoMinimizer espresso(parser.getNumInputs());
+        espresso.minimize(parser.getProductTerms());
+        cover_timer.stop();
+        cover_stage.end();
+        espresso.printSolution();
+
+        LOG(SUMMARY) << "\n[Step 3] Write Output PLA" << std::endl;
+        writer.setMinimalCover(espresso.getCover());
+        writer.setGenerator("Espresso-style heuristic (EXPAND, IRREDUNDANT, REDUCE)");
+        writer.setOptimality(false, 0);
+        return true;
+    }
+
+    Planner planner;
+
+    // Step 2: Extract minterms and don't cares
+
+    LOG(SUMMARY) << "\n[Step 2] Minterm Extraction" << std::endl;
+    if (logEnabled(LogLevel::DETAILED)) {
+        console() << "  ✓ On-set minterms: ";
+        for (size_t i = 0; i < minterms.size(); ++i) {
+            console() << "m" << minterms[i];
+            if (i < minterms.size() - 1) console() << ", ";
+        }
+        console() << std::endl;
+
+        console() << "  ✓ Don't cares: ";
+        if (dont_cares.empty()) {
+            console() << "(none)";
+        } else {
+            for (size_t i = 0; i < dont_cares.size(); ++i) {
+                console() << "m" << dont_cares[i];
+                if (i < dont_cares.size() - 1) console() << ", ";
+            }
+        }
+        console() << std::endl;
+    } else {
+        LOG(SUMMARY) << "  ✓ On-set minterms: " << minterms.size()
+                     << ", don't cares: " << dont_cares.size() << std::endl;
+    }
+
+    planner.analyzeInput(parser.getNumInputs(), parser.getProductTerms().size(),
+                         minterms, dont_cares);
+
+    // Incremental path: minimize once, then follow the edits of the function
+    if (!options.edits_file.empty()) {
+        if (parser.getNumInputs() > IncrementalMinimizer::MAX_VARS) {
+            result.error = "Incremental minimization handles at most " +
+                           std::to_string(IncrementalMinimizer::MAX_VARS) + " inputs.";
+            return false;
+        }
+        LOG(SUMMARY) << "\n[Step 3] Incremental Minimization" << std::endl;
+
+        ScopedTimer cover_timer("cover", &result.cover_seconds);
+        MemoryStage cover_stage(MemTrack::COVER);
+        IncrementalMinimizer minimizer(parser.getNumInputs());
+        minimizer.setFunction(minterms, dont_cares);
+        minimizer.minimize();
+        std::vector<Implicant> cover = minimizer.getCover();
+        LOG(SUMMARY) << "  ✓ Initial: " << cover.size() << " product terms, "
+                     << countLiterals(cover) << " literals; ";
+        minimizer.printUpdate();
+        LOG(SUMMARY) << std::endl;
+
+        if (!applyEdits(options.edits_file, parser.getNumInputs(), minimizer, result.error)) {
+            return false;
+        }
+
+        cover_timer.stop();
+        cover_stage.end();
+
+        // The output is the edited function, so it is not cached under the input's key
+        LOG(SUMMARY) << "\n[Step 4] Write Output PLA" << std::endl;
+        cover = minimizer.getCover();
+        writer.setMinimalCover(cover);
+        writer.setGenerator("Quine-McCluskey + incremental updates (pseudo-Boolean solver per component)");
+        writer.setOptimality(true, cover.size());
+        cache_key.clear();
+        return true;
+    }
+
+    // Small functions: look the minimum cover up in the precomputed table
+    // (only when no engine was requested explicitly)
+    std::vector<Implicant> table_cover;
+    if (!solver && options.prime_engine == "auto" && !options.list_optimal &&
+        NpTable::lookup(parser.getNumInputs(), minterms, dont_cares, table_cover)) {
+        LOG(SUMMARY) << "\n[Step 3] NP-Canonical Table Lookup" << std::endl;
+        LOG(SUMMARY) << "  ✓ Minimum cover found among " << NpTable::size()
+                     << " precomputed function classes" << std::endl;
+        for (size_t i = 0; i < table_cover.size(); i++) {
+            LOG(DETAILED) << "   PI" << (i + 1) << ": " << table_cover[i].value << std::endl;
+        }
+
+        LOG(SUMMARY) << "\n[Step 4] Write Output PLA" << std::endl;
+        writer.setMinimalCover(table_cover);
+        writer.setGenerator("Precomputed NP-canonical table (Quine-McCluskey + Petrick's Algorithm)");
+        writer.setOptimality(true, table_cover.size());
+        return true;
+    }
+
+    // Planner: pick the prime generator from the input statistics
+    std::string prime_engine = options.prime_engine;
+    if (prime_engine == "auto") {
+        planner.planPrimes();
+        planner.printPrimePlan();
+        prime_engine = planner.getPrimeEngine();
+    }
+
+    ScopedTimer prime_timer("primes", &result.prime_seconds);
+    MemoryStage prime_stage(MemTrack::PRIMES);
+    std::vector<Implicant> prime_implicants;
+    if (prime_engine == "sharded") {
+        // Step 3: Quine-McCluskey on cofactor shards in worker processes
+        if (parser.getNumInputs() > ShardedPrimeGenerator::MAX_VARS) {
+            result.error = "The sharded prime generator handles at most " +
+                           std::to_string(ShardedPrimeGenerator::MAX_VARS) + " inputs.";
+            return false;
+        }
+        LOG(SUMMARY) << "\n[Step 3] Sharded Prime Generation" << std::endl;
+
+        ShardedPrimeGenerator sharded(parser.getNumInputs(), options.prime_workers);
+        if (!sharded.findPrimeImplicants(minterms, dont_cares)) {
+            result.error = "Sharded prime generation failed: " + sharded.getError();
+            return false;
+        }
+        sharded.printSummary();
+        prime_implicants = sharded.getPrimeImplicants();
+    } else if (prime_engine == "consensus") {
+        // Step 3: Generate the primes from the input cubes
+        LOG(SUMMARY) << "\n[Step 3] Iterated Consensus" << std::endl;
+
+        ConsensusPrimeGenerator consensus(parser.getNumInputs());
+        consensus.findPrimeImplicants(parser.getProductTerms());
+        consensus.printSummary();
+        prime_implicants = consensus.getPrimeImplicants();
+    } else {
+        // Step 3: Run Quine-McCluskey Algorithm
+        LOG(SUMMARY) << "\n[Step 3] Quine-McCluskey Algorithm" << std::endl;
+
+        QuineMcCluskey qm(parser.getNumInputs());
+
+        // Print detailed steps
+        qm.printDetailedSteps(minterms, dont_cares);
+
+        // Find prime implicants
+        qm.findPrimeImplicants(minterms, dont_cares);
+        prime_implicants = qm.getPrimeImplicants();
+    }
+    LOG(SUMMARY) << "\n  ✓ Found " << prime_implicants.size() << " Prime Implicants" << std::endl;
+    result.num_primes = prime_implicants.size();
+    prime_timer.stop();
+    prime_stage.end();
+
+    ScopedTimer cover_timer("cover", &result.cover_seconds);
+    MemoryStage cover_stage(MemTrack::COVER);
+
+    // Planner: pick the covering engine from the chart statistics
+    if (!solver) {
+        planner.planCover(prime_implicants, minterms, dont_cares, budget);
+        planner.printPlan();
+        solver = createCoverSolver(planner.getCoverEngine());
+    }
+
+    // Step 4: Select a cover (engine chosen by the planner by default)
+    solver->setNumThreads(options.num_threads);
+    solver->setBudget(budget);
+    solver->solve(prime_implicants, minterms, dont_cares);
+    solver->printSolution();
+
+    if (options.list_optimal) {
+        LOG(SUMMARY) << "\n[Step 4b] All Minimum Covers (fewest literals first)" << std::endl;
+
+        CoverEnumerator covers(prime_implicants, minterms, dont_cares);
+        std::vector<int> cover;
+        while (covers.next(cover)) {
+            LOG(SUMMARY) << "  Cover " << covers.getCoversProduced() << ":";
+            for (int idx : cover) {
+                LOG(SUMMARY) << " " << prime_implicants[idx].value;
+            }
+            LOG(SUMMARY) << "  (" << cover.size() << " PIs, "
+                         << covers.countLiterals(cover) << " literals)" << std::endl;
+        }
+    }
+
+    cover_timer.stop();
+    cover_stage.end();
+
+    // Step 5: Write output PLA
+    LOG(SUMMARY) << "\n[Step 5] Write Output PLA" << std::endl;
+
+    writer.setMinimalCover(solver->getMinimalCover());
+    writer.setGenerator(describeGenerator(prime_engine, solver->getName()));
+    writer.setOptimality(solver->isProvenOptimal(), solver->getLowerBound());
+
+    // A cover cut short by a limit is not stored: a later run may do better
+    if (budget.isLimited() && !solver->isProvenOptimal()) cache_key.clear();
+
+    return true;
+}
+
+// All steps of minimizePla; the wrappers add the timing
+// A null input_text / output_text means the files named input_pla / output_pla
+static MinimizeResult runSteps(const MinimizerOptions& options,
+                               const std::string& input_pla, std::istream* input_text,
+                               const std::string& output_pla, std::ostream* output_text,
+                               ResultCache& cache) {
+    MinimizeResult result;
+
+    LOG(SUMMARY) << "====================================" << std::endl;
+    LOG(SUMMARY) << "  Boolean Function Minimization" << std::endl;
+    LOG(SUMMARY) << "====================================" << std::endl;
+    LOG(SUMMARY) << "Input  PLA: " << input_pla << std::endl;
+    LOG(SUMMARY) << "Output PLA: " << output_pla << std::endl;
+
+    // Step 1: Parse PLA file
+    ScopedTimer parse_timer("parse", &result.parse_seconds);
+    MemoryStage parse_stage(MemTrack::PARSE);
+    PlaParser parser;
+    if (!(input_text ? parser.parse(*input_text) : parser.parse(input_pla))) {
+        result.error = "Failed to parse PLA file: " + parser.getError();
+        return result;
+    }
+    parse_timer.stop();
+    parse_stage.end();
+    result.num_inputs = parser.getNumInputs();
+    LOG(SUMMARY) << "\n[Step 1] PLA Parsing" << std::endl;
+    LOG(SUMMARY) << "  ✓ Inputs: " << parser.getNumInputs() << std::endl;
+    LOG(SUMMARY) << "  ✓ Product terms: " << parser.getProductTerms().size() << std::endl;
+
+    PlaWriter writer(parser.getNumInputs(),
+                     parser.getInputNames(),
+                     "F");
+
+    std::string cache_key;
+    if (minimizeParsed(options, parser, writer, cache, cache_key, result)) {
+        ScopedTimer write_timer("write", &result.write_seconds);
+        MemoryStage write_stage(MemTrack::WRITE);
+        writeOutput(writer, output_pla, output_text, cache, cache_key, result);
+    }
+
+    // Load both files again and check the written cover against the input
+    if (result.ok && options.verify && !output_text) {
+        ScopedTimer verify_timer("verify");
+        CoverVerifier verifier(options.num_threads);
+        if (!verifier.verifyFiles(input_pla, output_pla)) {
+            result.ok = false;
+            result.error = "Verification failed: " + verifier.describeFailure();
+        }
+        verifier.printResult();
+    }
+    return result;
+}
+
+MinimizeResult minimizePla(const MinimizerOptions& options, const std::string& input_pla,
+                           const std::string& output_pla, ResultCache& cache) {
+    auto start = Clock::now();
+    MinimizeResult result = runSteps(options, input_pla, nullptr, output_pla, nullptr, cache);
+    result.seconds = secondsSince(start);
+    return result;
+}
+
+MinimizeResult minimizePlaText(const MinimizerOptions& options, const std::string& input_text,
+                               std::string& output_text, ResultCache& cache) {
+    auto start = Clock::now();
+    std::istringstream input(input_text);
+    std::ostringstream output;
+    MinimizeResult result = runSteps(options, "(request)", &input, "(response)", &output, cache);
+    output_text = result.ok ? output.str() : "";
+    result.seconds = secondsSince(start);
+    return result;
+}
+
+long peakRssKb() {
+    // VmHWM is this process's own high-water mark; ru_maxrss also keeps the
+    // peak of the parent's memory copied by fork() before exec
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) return std::atol(line.c_str() + 6);
+    }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return usage.ru_maxrss;  // Kilobytes on Linux
+}
+
+bool appendSummary(const std::string& path, const std::string& input_pla,
+                   const MinimizeResult& result) {
+    std::ifstream existing(path);
+    bool has_header = existing.peek() != std::ifstream::traits_type::eof();
+    existing.close();
+
+    std::ofstream file(path, std::ios::app);
+    if (!file.is_open()) return false;
+    if (!has_header) {
+        file << "file\tstatus\tinputs\tprimes\tterms\tliterals\toptimal\t"
+             << "parse_s\tprimes_s\tcover_s\twrite_s\ttotal_s\tpeak_rss_kb\n";
+    }
+    file << input_pla << "\t" << (result.ok ? "ok" : "failed") << "\t" << result.num_inputs
+         << "\t" << result.num_primes << "\t" << result.product_terms << "\t" << result.literals
+         << "\t" << (result.proven_optimal ? "yes" : "no") << std::fixed << std::setprecision(6)
+         << "\t" << result.parse_seconds << "\t" << result.prime_seconds
+         << "\t" << result.cover_seconds << "\t" << result.write_seconds
+         << "\t" << result.seconds << "\t" << peakRssKb() << "\n";
+    return file.good();
+}
+
+// File names in the JSON output
+static std::string jsonString(const std::string& text) {
+    std::ostringstream out;
+    out << "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                << std::dec << std::setfill(' ');
+        } else {
+            out << c;
+        }
+    }
+    out << "\"";
+    return out.str();
+}
+
+void writeStatsJson(std::ostream& out, const std::string& input_pla,
+                    const MinimizeResult& result, const RunStats& stats) {
+    out << "{\"file\": " << jsonString(input_pla) << ", \"ok\": " << (result.ok ? "true" : "false");
+    if (!result.ok) out << ", \"error\": " << jsonString(result.error);
+    out << ", \"inputs\": " << result.num_inputs << ", \"primes\": " << result.num_primes
+        << ", \"terms\": " << result.product_terms << ", \"literals\": " << result.literals
+        << ", \"optimal\": " << (result.proven_optimal ? "true" : "false")
+        << std::fixed << std::setprecision(6) << ", \"seconds\": " << result.seconds
+        << ", \"peak_rss_kb\": " << peakRssKb() << ", ";
+    stats.writeJsonMembers(out);
+    if (MemTrack::enabled()) {
+        out << ", ";
+        MemTrack::writeJsonMember(out);
+    }
+    out << "}" << std::endl;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "CoverBudget.h"
+#include "ResultCache.h"
+#include <ostream>
+#include <string>
+
+class PlaParser;
+class PlaWriter;
+class RunStats;
+
+// Settings of a minimization run (the command line options)
+struct MinimizerOptions {
+    std::string engine = "qm";           // qm or espresso
+    std::string prime_engine = "auto";   // auto, qm, consensus or sharded
+    int prime_workers = 0;               // Processes of the sharded generator (0 = all cores)
+    std::string cover_engine = "auto";   // auto, petrick, greedy or pb
+    int num_threads = 0;                 // Threads for Petrick's method (0 = all cores)
+    CoverBudget budget;                  // Limits of the covering stage
+    bool list_optimal = false;           // List every minimum cover
+    std::string edits_file;              // Edits for the incremental minimizer
+    bool verify = false;                 // Check the written cover against the input
+    int max_minterm_inputs = 30;         // Largest function for the qm engine (minterms are ints)
+};
+
+// Error message for an unknown engine name in the options (empty if valid)
+std::string checkOptions(const MinimizerOptions& options);
+
+// Outcome of one run
+struct MinimizeResult {
+    bool ok = false;
+    std::string error;                   // Why the run failed
+    int num_inputs = 0;
+    int product_terms = 0;
+    int literals = 0;
+    bool proven_optimal = false;
+    int num_primes = 0;                  // Prime implicants generated (0: no prime stage)
+    double seconds = 0;                  // Wall-clock time of the whole run
+
+    // Wall-clock time of the stages; cover_seconds is the whole minimization
+    // on the espresso and incremental paths
+    double parse_seconds = 0;
+    double prime_seconds = 0;
+    double cover_seconds = 0;
+    double write_seconds = 0;
+};
+
+// The whole flow for one PLA file: parse, minimize, write the output, and
+// with options.verify read it back and check it against the input (a cover
+// that differs fails the run). Progress goes to console(). The options must
+// name known engines.
+// The cache may be disabled; it can be shared by concurrent runs.
+MinimizeResult minimizePla(const MinimizerOptions& options, const std::string& input_pla,
+                           const std::string& output_pla, ResultCache& cache);
+
+// The same flow on PLA text held in memory (the server's requests): no files
+// are touched and the minimized PLA is returned in output_text
+MinimizeResult minimizePlaText(const MinimizerOptions& options, const std::string& input_text,
+                               std::string& output_text, ResultCache& cache);
+
+// Peak resident set size of this process so far, in KB
+long peakRssKb();
+
+// Append the result as a TSV row to path (with a header if the file is new):
+// stage times, prime count, cover size and the process's peak RSS
+bool appendSummary(const std::string& path, const std::string& input_pla,
+                   const MinimizeResult& result);
+
+// One line of JSON: the result and the statistics collected during the run
+// (--stats=json)
+void writeStatsJson(std::ostream& out, const std::string& input_pla,
+                    const MinimizeResult& result, const RunStats& stats);
+
+// The steps after parsing, on a function held by the parser: sets the cover,
+// generator and optimality of the writer but writes nothing. cache_key
+// receives the key to store the result under (empty: not to be stored).
+// Returns false with result.error set if the run failed.
+bool minimizeParsed(const MinimizerOptions& options, const PlaParser& parser,
+                    PlaWriter& writer, ResultCache& cache, std::string& cache_key,
+                    MinimizeResult& result);
@@ -0,0 +1,99 @@
+#include "NpTable.h"
+#include "NpTableData.h"
+#include <algorithm>
+#include <sstream>
+
+const int NpTable::MAX_VARS;
+const int NpTable::MAX_DC_VARS;
+
+uint32_t NpTable::apply(uint32_t table, int num_vars, const Transform& t) {
+    uint32_t result = 0;
+    for (int m = 0; m < (1 << num_vars); m++) {
+        if (!(table >> m & 1)) continue;
+
+        int image = 0;
+        for (int i = 0; i < num_vars; i++) {
+            int value = (m >> (num_vars - 1 - i) & 1) ^ (t.flips >> i & 1);
+            image |= value << (num_vars - 1 - t.perm[i]);
+        }
+        result |= uint32_t(1) << image;
+    }
+    return result;
+}
+
+void NpTable::canonicalize(int num_vars, uint32_t on, uint32_t dc,
+                           uint32_t& canon_on, uint32_t& canon_dc, Transform& t) {
+    Transform current;
+    for (int i = 0; i < MAX_VARS; i++) current.perm[i] = i;
+
+    bool first = true;
+    do {
+        for (current.flips = 0; current.flips < (1 << num_vars); current.flips++) {
+            uint32_t new_on = apply(on, num_vars, current);
+            uint32_t new_dc = apply(dc, num_vars, current);
+            if (first || new_on < canon_on || (new_on == canon_on && new_dc < canon_dc)) {
+                canon_on = new_on;
+                canon_dc = new_dc;
+                t = current;
+                first = false;
+            }
+        }
+    } while (std::next_permutation(current.perm, current.perm + num_vars));
+}
+
+std::string NpTable::cubeToOriginal(const std::string& cube, const Transform& t) {
+    std::string original(cube.size(), '-');
+    for (size_t i = 0; i < cube.size(); i++) {
+        char c = cube[t.perm[i]];
+        if (c != '-' && (t.flips >> i & 1)) c = (c == '0') ? '1' : '0';
+        original[i] = c;
+    }
+    return original;
+}
+
+bool NpTable::inRange(int num_vars, bool has_dont_cares) {
+    return num_vars >= 1 && num_vars <= (has_dont_cares ? MAX_DC_VARS : MAX_VARS);
+}
+
+bool NpTable::lookup(int num_vars, const std::vector<int>& minterms,
+                     const std::vector<int>& dont_cares, std::vector<Implicant>& cover) {
+    if (!inRange(num_vars, !dont_cares.empty())) return false;
+
+    uint32_t on = 0, dc = 0;
+    for (int m : minterms) on |= uint32_t(1) << m;
+    for (int d : dont_cares) dc |= uint32_t(1) << d;
+    dc &= ~on;
+
+    uint32_t canon_on, canon_dc;
+    Transform t;
+    canonicalize(num_vars, on, dc, canon_on, canon_dc, t);
+
+    uint64_t key = makeKey(num_vars, canon_on, canon_dc);
+    const NpTableEntry* end = NP_TABLE + NP_TABLE_SIZE;
+    const NpTableEntry* entry = std::lower_bound(NP_TABLE, end, key,
+        [](const NpTableEntry& e, uint64_t k) { return e.key < k; });
+    if (entry == end || entry->key != key) return false;
+
+    cover.clear();
+    std::istringstream cubes(entry->cover);
+    std::string cube;
+    while (cubes >> cube) {
+        cover.push_back(Implicant(cubeToOriginal(cube, t), std::set<int>()));
+    }
+
+    // Same order as the exact path: fewer '-' first, then fewer 1's
+    std::sort(cover.begin(), cover.end(), [](const Implicant& a, const Implicant& b) {
+        int dash_a = std::count(a.value.begin(), a.value.end(), '-');
+        int dash_b = std::count(b.value.begin(), b.value.end(), '-');
+        if (dash_a != dash_b) return dash_a < dash_b;
+        int ones_a = std::count(a.value.begin(), a.value.end(), '1');
+        int ones_b = std::count(b.value.begin(), b.value.end(), '1');
+        if (ones_a != ones_b) return ones_a < ones_b;
+        return a.value < b.value;
+    });
+    return true;
+}
+
+int NpTable::size() {
+    return NP_TABLE_SIZE;
+}
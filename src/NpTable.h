@@ -0,0 +1,66 @@
+#pragma once
+#include "QuineMcCluskey.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One precomputed minimum cover, in the canonical form of its class
+// key = num_vars << 32 | on << 16 | dc, cover = cubes separated by spaces
+struct NpTableEntry {
+    uint64_t key;
+    const char* cover;
+};
+
+// Precomputed minimum covers of small functions, up to NP equivalence
+// A function of at most 4 inputs is packed into two truth tables: bit m of
+// `on` is set when minterm m is in the on-set, bit m of `dc` when it is a
+// don't care (minterm numbers as in the PLA file, first input = MSB).
+//
+// Permuting the inputs and complementing some of them (an NP transform)
+// maps every minimum SOP of f onto a minimum SOP of the transformed
+// function, with the same number of terms and literals. So one exact
+// solution per class is enough: the canonical form is the smallest
+// (on, dc) pair over all n! * 2^n transforms, and a small function is
+// canonicalized, looked up and its cover transformed back.
+// Output negation (the N in NPN) is left out on purpose: a cover of the
+// complement of f is not a cover of f.
+//
+// The table (NpTableData.h) is generated by `make np-table`, which runs
+// QuineMcCluskey + PetrickSolver once per class. It holds every completely
+// specified function of up to MAX_VARS inputs and, since don't cares
+// multiply the number of classes, functions with don't cares only up to
+// MAX_DC_VARS inputs.
+class NpTable {
+public:
+    static const int MAX_VARS = 4;
+    static const int MAX_DC_VARS = 3;
+
+    struct Transform {
+        int perm[MAX_VARS];  // Input i of f becomes input perm[i]
+        int flips;           // Bit i set: input i is complemented
+    };
+
+    // Apply t to a truth table of num_vars inputs
+    static uint32_t apply(uint32_t table, int num_vars, const Transform& t);
+
+    // Canonical form of (on, dc); t maps the function onto it
+    static void canonicalize(int num_vars, uint32_t on, uint32_t dc,
+                             uint32_t& canon_on, uint32_t& canon_dc, Transform& t);
+
+    // Map a cube of the canonical function back onto the inputs of f
+    static std::string cubeToOriginal(const std::string& cube, const Transform& t);
+
+    static uint64_t makeKey(int num_vars, uint32_t on, uint32_t dc) {
+        return (uint64_t(num_vars) << 32) | (uint64_t(on) << 16) | dc;
+    }
+
+    // Is the function inside the table's range?
+    static bool inRange(int num_vars, bool has_dont_cares);
+
+    // Minimum cover of a small function (fewest PIs, then fewest literals)
+    // Returns false when the function is not in the table
+    static bool lookup(int num_vars, const std::vector<int>& minterms,
+                       const std::vector<int>& dont_cares, std::vector<Implicant>& cover);
+
+    static int size();  // Number of classes in the table
+};
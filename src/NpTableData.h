@@ -0,0 +1,705 @@
+// Generated by `make np-table` (tools/gen_np_table.cpp) - do not edit
+// One minimum cover per NP class, in canonical form, sorted by key
+#pragma once
+#include "NpTable.h"
+
+constexpr NpTableEntry NP_TABLE[] = {
+    {0x100000000ULL, ""},
+    {0x100000001ULL, ""},
+    {0x100000003ULL, ""},
+    {0x100010000ULL, "0"},
+    {0x100010002ULL, "-"},
+    {0x100030000ULL, "-"},
+    {0x200000000ULL, ""},
+    {0x200000001ULL, ""},
+    {0x200000003ULL, ""},
+    {0x200000006ULL, ""},
+    {0x200000007ULL, ""},
+    {0x20000000fULL, ""},
+    {0x200010000ULL, "00"},
+    {0x200010002ULL, "0-"},
+    {0x200010006ULL, "0-"},
+    {0x200010008ULL, "00"},
+    {0x20001000aULL, "0-"},
+    {0x20001000eULL, "--"},
+    {0x200030000ULL, "0-"},
+    {0x200030004ULL, "0-"},
+    {0x20003000cULL, "--"},
+    {0x200060000ULL, "01 10"},
+    {0x200060001ULL, "0- -0"},
+    {0x200060009ULL, "--"},
+    {0x200070000ULL, "0- -0"},
+    {0x200070008ULL, "--"},
+    {0x2000f0000ULL, "--"},
+    {0x300000000ULL, ""},
+    {0x300000001ULL, ""},
+    {0x300000003ULL, ""},
+    {0x300000006ULL, ""},
+    {0x300000007ULL, ""},
+    {0x30000000fULL, ""},
+    {0x300000016ULL, ""},
+    {0x300000017ULL, ""},
+    {0x300000018ULL, ""},
+    {0x300000019ULL, ""},
+    {0x30000001bULL, ""},
+    {0x30000001eULL, ""},
+    {0x30000001fULL, ""},
+    {0x30000003cULL, ""},
+    {0x30000003dULL, ""},
+    {0x30000003fULL, ""},
+    {0x300000069ULL, ""},
+    {0x30000006bULL, ""},
+    {0x30000006fULL, ""},
+    {0x30000007eULL, ""},
+    {0x30000007fULL, ""},
+    {0x3000000ffULL, ""},
+    {0x300010000ULL, "000"},
+    {0x300010002ULL, "00-"},
+    {0x300010006ULL, "00-"},
+    {0x300010008ULL, "000"},
+    {0x30001000aULL, "00-"},
+    {0x30001000eULL, "0--"},
+    {0x300010016ULL, "00-"},
+    {0x300010018ULL, "-00"},
+    {0x30001001aULL, "00-"},
+    {0x30001001eULL, "0--"},
+    {0x300010028ULL, "000"},
+    {0x30001002aULL, "00-"},
+    {0x30001002cULL, "0-0"},
+    {0x30001002eULL, "0--"},
+    {0x30001003cULL, "0-0"},
+    {0x30001003eULL, "0--"},
+    {0x300010068ULL, "000"},
+    {0x30001006aULL, "00-"},
+    {0x30001006eULL, "0--"},
+    {0x30001007eULL, "0--"},
+    {0x300010080ULL, "000"},
+    {0x300010082ULL, "00-"},
+    {0x300010086ULL, "00-"},
+    {0x300010088ULL, "000"},
+    {0x30001008aULL, "00-"},
+    {0x30001008eULL, "0--"},
+    {0x300010096ULL, "00-"},
+    {0x300010098ULL, "-00"},
+    {0x30001009aULL, "00-"},
+    {0x30001009eULL, "0--"},
+    {0x3000100a8ULL, "000"},
+    {0x3000100aaULL, "00-"},
+    {0x3000100acULL, "0-0"},
+    {0x3000100aeULL, "0--"},
+    {0x3000100bcULL, "0-0"},
+    {0x3000100beULL, "0--"},
+    {0x3000100e8ULL, "000"},
+    {0x3000100eaULL, "00-"},
+    {0x3000100eeULL, "0--"},
+    {0x3000100feULL, "---"},
+    {0x300030000ULL, "00-"},
+    {0x300030004ULL, "00-"},
+    {0x30003000cULL, "0--"},
+    {0x300030014ULL, "00-"},
+    {0x300030018ULL, "00-"},
+    {0x30003001cULL, "0--"},
+    {0x30003003cULL, "0--"},
+    {0x300030040ULL, "00-"},
+    {0x300030044ULL, "00-"},
+    {0x300030048ULL, "00-"},
+    {0x30003004cULL, "0--"},
+    {0x300030054ULL, "00-"},
+    {0x300030058ULL, "00-"},
+    {0x30003005cULL, "0--"},
+    {0x300030068ULL, "00-"},
+    {0x30003006cULL, "0--"},
+    {0x30003007cULL, "0--"},
+    {0x3000300c0ULL, "00-"},
+    {0x3000300c4ULL, "00-"},
+    {0x3000300ccULL, "0--"},
+    {0x3000300d4ULL, "00-"},
+    {0x3000300d8ULL, "00-"},
+    {0x3000300dcULL, "0--"},
+    {0x3000300fcULL, "---"},
+    {0x300060000ULL, "001 010"},
+    {0x300060001ULL, "00- 0-0"},
+    {0x300060009ULL, "0--"},
+    {0x300060010ULL, "001 010"},
+    {0x300060011ULL, "00- 0-0"},
+    {0x300060018ULL, "0-1 01-"},
+    {0x300060019ULL, "0--"},
+    {0x300060020ULL, "010 -01"},
+    {0x300060021ULL, "00- 0-0"},
+    {0x300060029ULL, "0--"},
+    {0x300060030ULL, "010 -01"},
+    {0x300060031ULL, "0-0 -0-"},
+    {0x300060038ULL, "0-1 01-"},
+    {0x300060039ULL, "0--"},
+    {0x300060060ULL, "-01 -10"},
+    {0x300060061ULL, "00- 0-0"},
+    {0x300060069ULL, "0--"},
+    {0x300060070ULL, "-01 -10"},
+    {0x300060071ULL, "-0- --0"},
+    {0x300060078ULL, "0-1 01-"},
+    {0x300060079ULL, "0--"},
+    {0x300060090ULL, "001 010"},
+    {0x300060091ULL, "00- 0-0"},
+    {0x300060099ULL, "0--"},
+    {0x3000600b0ULL, "010 -01"},
+    {0x3000600b1ULL, "0-0 -0-"},
+    {0x3000600b9ULL, "0--"},
+    {0x3000600f0ULL, "-01 -10"},
+    {0x3000600f1ULL, "-0- --0"},
+    {0x3000600f9ULL, "---"},
+    {0x300070000ULL, "00- 0-0"},
+    {0x300070008ULL, "0--"},
+    {0x300070010ULL, "00- 0-0"},
+    {0x300070018ULL, "0--"},
+    {0x300070020ULL, "00- 0-0"},
+    {0x300070028ULL, "0--"},
+    {0x300070030ULL, "0-0 -0-"},
+    {0x300070038ULL, "0--"},
+    {0x300070060ULL, "00- 0-0"},
+    {0x300070068ULL, "0--"},
+    {0x300070070ULL, "-0- --0"},
+    {0x300070078ULL, "0--"},
+    {0x300070080ULL, "00- 0-0"},
+    {0x300070088ULL, "0--"},
+    {0x300070090ULL, "00- 0-0"},
+    {0x300070098ULL, "0--"},
+    {0x3000700a0ULL, "00- 0-0"},
+    {0x3000700a8ULL, "0--"},
+    {0x3000700b0ULL, "0-0 -0-"},
+    {0x3000700b8ULL, "0--"},
+    {0x3000700e0ULL, "00- 0-0"},
+    {0x3000700e8ULL, "0--"},
+    {0x3000700f0ULL, "-0- --0"},
+    {0x3000700f8ULL, "---"},
+    {0x3000f0000ULL, "0--"},
+    {0x3000f0010ULL, "0--"},
+    {0x3000f0030ULL, "0--"},
+    {0x3000f0060ULL, "0--"},
+    {0x3000f0070ULL, "0--"},
+    {0x3000f00f0ULL, "---"},
+    {0x300160000ULL, "001 010 100"},
+    {0x300160001ULL, "00- 0-0 -00"},
+    {0x300160008ULL, "100 0-1 01-"},
+    {0x300160009ULL, "-00 0--"},
+    {0x300160028ULL, "0-1 01- 10-"},
+    {0x300160029ULL, "0-- -0-"},
+    {0x300160068ULL, "0-1 01- 10-"},
+    {0x300160069ULL, "0-- -0-"},
+    {0x300160080ULL, "001 010 100"},
+    {0x300160081ULL, "00- 0-0 -00"},
+    {0x300160088ULL, "100 0-1 01-"},
+    {0x300160089ULL, "-00 0--"},
+    {0x3001600a8ULL, "01- 10- --1"},
+    {0x3001600a9ULL, "0-- -0-"},
+    {0x3001600e8ULL, "--1 -1- 1--"},
+    {0x3001600e9ULL, "---"},
+    {0x300170000ULL, "00- 0-0 -00"},
+    {0x300170008ULL, "-00 0--"},
+    {0x300170028ULL, "0-- -0-"},
+    {0x300170068ULL, "0-- -0-"},
+    {0x300170080ULL, "00- 0-0 -00"},
+    {0x300170088ULL, "-00 0--"},
+    {0x3001700a8ULL, "0-- -0-"},
+    {0x3001700e8ULL, "---"},
+    {0x300180000ULL, "100 011"},
+    {0x300180001ULL, "011 -00"},
+    {0x300180003ULL, "-00 0-1"},
+    {0x300180006ULL, "100 0-1"},
+    {0x300180007ULL, "-00 0--"},
+    {0x300180024ULL, "10- 01-"},
+    {0x300180025ULL, "-00 01-"},
+    {0x300180027ULL, "-0- 0--"},
+    {0x300180061ULL, "011 -00"},
+    {0x300180063ULL, "0-1 -0-"},
+    {0x300180066ULL, "10- 0-1"},
+    {0x300180067ULL, "-0- 0--"},
+    {0x3001800e7ULL, "---"},
+    {0x300190000ULL, "011 -00"},
+    {0x300190002ULL, "-00 0-1"},
+    {0x300190006ULL, "-00 0--"},
+    {0x300190020ULL, "011 -00"},
+    {0x300190022ULL, "0-1 -0-"},
+    {0x300190024ULL, "-00 01-"},
+    {0x300190026ULL, "-0- 0--"},
+    {0x300190060ULL, "011 -00"},
+    {0x300190062ULL, "0-1 -0-"},
+    {0x300190066ULL, "-0- 0--"},
+    {0x300190080ULL, "-00 -11"},
+    {0x300190082ULL, "-00 0-1"},
+    {0x300190086ULL, "-00 0--"},
+    {0x3001900a0ULL, "-00 -11"},
+    {0x3001900a2ULL, "-0- --1"},
+    {0x3001900a4ULL, "-00 01-"},
+    {0x3001900a6ULL, "-0- 0--"},
+    {0x3001900e0ULL, "-00 -11"},
+    {0x3001900e2ULL, "-0- --1"},
+    {0x3001900e6ULL, "---"},
+    {0x3001b0000ULL, "-00 0-1"},
+    {0x3001b0004ULL, "-00 0--"},
+    {0x3001b0024ULL, "-0- 0--"},
+    {0x3001b0040ULL, "-00 0-1"},
+    {0x3001b0044ULL, "0-- --0"},
+    {0x3001b0060ULL, "0-1 -0-"},
+    {0x3001b0064ULL, "-0- 0--"},
+    {0x3001b00c0ULL, "-00 0-1"},
+    {0x3001b00c4ULL, "0-- --0"},
+    {0x3001b00e4ULL, "---"},
+    {0x3001e0000ULL, "100 0-1 01-"},
+    {0x3001e0001ULL, "-00 0--"},
+    {0x3001e0020ULL, "0-1 01- 10-"},
+    {0x3001e0021ULL, "0-- -0-"},
+    {0x3001e0060ULL, "0-1 01- 10-"},
+    {0x3001e0061ULL, "0-- -0-"},
+    {0x3001e0080ULL, "100 0-1 01-"},
+    {0x3001e0081ULL, "-00 0--"},
+    {0x3001e00a0ULL, "01- 10- --1"},
+    {0x3001e00a1ULL, "0-- -0-"},
+    {0x3001e00e0ULL, "--1 -1- 1--"},
+    {0x3001e00e1ULL, "---"},
+    {0x3001f0000ULL, "-00 0--"},
+    {0x3001f0020ULL, "0-- -0-"},
+    {0x3001f0060ULL, "0-- -0-"},
+    {0x3001f0080ULL, "-00 0--"},
+    {0x3001f00a0ULL, "0-- -0-"},
+    {0x3001f00e0ULL, "---"},
+    {0x3003c0000ULL, "01- 10-"},
+    {0x3003c0001ULL, "01- 10-"},
+    {0x3003c0003ULL, "0-- -0-"},
+    {0x3003c0041ULL, "01- 10-"},
+    {0x3003c0042ULL, "01- 10-"},
+    {0x3003c0043ULL, "0-- -0-"},
+    {0x3003c00c3ULL, "---"},
+    {0x3003d0000ULL, "0-0 01- 10-"},
+    {0x3003d0002ULL, "0-- -0-"},
+    {0x3003d0040ULL, "01- 10- --0"},
+    {0x3003d0042ULL, "0-- -0-"},
+    {0x3003d0080ULL, "0-0 01- 10-"},
+    {0x3003d0082ULL, "0-- -0-"},
+    {0x3003d00c0ULL, "--0 -1- 1--"},
+    {0x3003d00c2ULL, "---"},
+    {0x3003f0000ULL, "0-- -0-"},
+    {0x3003f0040ULL, "0-- -0-"},
+    {0x3003f00c0ULL, "---"},
+    {0x300690000ULL, "000 011 101 110"},
+    {0x300690002ULL, "110 00- 0-1 -01"},
+    {0x300690006ULL, "-01 -10 0--"},
+    {0x300690016ULL, "0-- -0- --0"},
+    {0x300690096ULL, "---"},
+    {0x3006b0000ULL, "110 00- 0-1 -01"},
+    {0x3006b0004ULL, "-01 -10 0--"},
+    {0x3006b0014ULL, "0-- -0- --0"},
+    {0x3006b0094ULL, "---"},
+    {0x3006f0000ULL, "-01 -10 0--"},
+    {0x3006f0010ULL, "0-- -0- --0"},
+    {0x3006f0090ULL, "---"},
+    {0x3007e0000ULL, "0-1 -10 10-"},
+    {0x3007e0001ULL, "0-- -0- --0"},
+    {0x3007e0081ULL, "---"},
+    {0x3007f0000ULL, "0-- -0- --0"},
+    {0x3007f0080ULL, "---"},
+    {0x300ff0000ULL, "---"},
+    {0x400000000ULL, ""},
+    {0x400010000ULL, "0000"},
+    {0x400030000ULL, "000-"},
+    {0x400060000ULL, "0001 0010"},
+    {0x400070000ULL, "000- 00-0"},
+    {0x4000f0000ULL, "00--"},
+    {0x400160000ULL, "0001 0010 0100"},
+    {0x400170000ULL, "000- 00-0 0-00"},
+    {0x400180000ULL, "0100 0011"},
+    {0x400190000ULL, "0011 0-00"},
+    {0x4001b0000ULL, "0-00 00-1"},
+    {0x4001e0000ULL, "0100 00-1 001-"},
+    {0x4001f0000ULL, "0-00 00--"},
+    {0x4003c0000ULL, "001- 010-"},
+    {0x4003d0000ULL, "00-0 001- 010-"},
+    {0x4003f0000ULL, "00-- 0-0-"},
+    {0x400690000ULL, "0000 0011 0101 0110"},
+    {0x4006b0000ULL, "0110 000- 00-1 0-01"},
+    {0x4006f0000ULL, "0-01 0-10 00--"},
+    {0x4007e0000ULL, "00-1 0-10 010-"},
+    {0x4007f0000ULL, "00-- 0-0- 0--0"},
+    {0x400ff0000ULL, "0---"},
+    {0x401160000ULL, "0001 0010 0100 1000"},
+    {0x401170000ULL, "000- 00-0 0-00 -000"},
+    {0x401180000ULL, "0100 1000 0011"},
+    {0x401190000ULL, "0011 0-00 -000"},
+    {0x4011a0000ULL, "0100 1000 00-1"},
+    {0x4011b0000ULL, "0-00 -000 00-1"},
+    {0x4011e0000ULL, "0100 1000 00-1 001-"},
+    {0x4011f0000ULL, "0-00 -000 00--"},
+    {0x4012c0000ULL, "1000 0101 001-"},
+    {0x4012d0000ULL, "0101 -000 001-"},
+    {0x4012f0000ULL, "-000 0-01 00--"},
+    {0x4013c0000ULL, "1000 001- 010-"},
+    {0x4013d0000ULL, "-000 001- 010-"},
+    {0x4013e0000ULL, "1000 00-1 001- 010-"},
+    {0x4013f0000ULL, "-000 00-- 0-0-"},
+    {0x401680000ULL, "1000 0011 0101 0110"},
+    {0x401690000ULL, "0011 0101 0110 -000"},
+    {0x4016a0000ULL, "1000 0110 00-1 0-01"},
+    {0x4016b0000ULL, "0110 -000 00-1 0-01"},
+    {0x4016e0000ULL, "1000 00-1 0-01 0-10"},
+    {0x4016f0000ULL, "-000 0-01 0-10 00--"},
+    {0x4017e0000ULL, "1000 00-1 0-10 010-"},
+    {0x4017f0000ULL, "-000 00-- 0-0- 0--0"},
+    {0x401800000ULL, "1000 0111"},
+    {0x401810000ULL, "0111 -000"},
+    {0x401820000ULL, "0001 1000 0111"},
+    {0x401830000ULL, "0111 000- -000"},
+    {0x401860000ULL, "0001 0010 1000 0111"},
+    {0x401870000ULL, "0111 000- 00-0 -000"},
+    {0x401890000ULL, "-000 0-11"},
+    {0x4018b0000ULL, "000- -000 0-11"},
+    {0x4018f0000ULL, "-000 0-11 00--"},
+    {0x401960000ULL, "0001 0010 0100 1000 0111"},
+    {0x401970000ULL, "0111 000- 00-0 0-00 -000"},
+    {0x401980000ULL, "0100 1000 0-11"},
+    {0x401990000ULL, "0-00 -000 0-11"},
+    {0x4019a0000ULL, "0100 1000 00-1 0-11"},
+    {0x4019b0000ULL, "000- 0-00 -000 0-11"},
+    {0x4019e0000ULL, "0100 1000 00-1 001- 0-11"},
+    {0x4019f0000ULL, "0-00 -000 0-11 00--"},
+    {0x401a80000ULL, "1000 0-11 01-1"},
+    {0x401a90000ULL, "-000 0-11 01-1"},
+    {0x401aa0000ULL, "1000 0--1"},
+    {0x401ab0000ULL, "-000 0--1"},
+    {0x401ac0000ULL, "1000 001- 01-1"},
+    {0x401ad0000ULL, "-000 001- 01-1"},
+    {0x401ae0000ULL, "1000 001- 0--1"},
+    {0x401af0000ULL, "-000 00-- 0--1"},
+    {0x401bc0000ULL, "1000 001- 010- 0-11"},
+    {0x401bd0000ULL, "00-0 -000 010- 0-11"},
+    {0x401be0000ULL, "1000 001- 010- 0--1"},
+    {0x401bf0000ULL, "-000 00-- 0-0- 0--1"},
+    {0x401e80000ULL, "1000 0-11 01-1 011-"},
+    {0x401e90000ULL, "-000 0-11 01-1 011-"},
+    {0x401ea0000ULL, "1000 011- 0--1"},
+    {0x401eb0000ULL, "-000 011- 0--1"},
+    {0x401ee0000ULL, "1000 0--1 0-1-"},
+    {0x401ef0000ULL, "-000 0--1 0-1-"},
+    {0x401fe0000ULL, "1000 0--1 0-1- 01--"},
+    {0x401ff0000ULL, "-000 0---"},
+    {0x4033c0000ULL, "001- 010- 100-"},
+    {0x4033d0000ULL, "00-0 001- 010- 100-"},
+    {0x4033f0000ULL, "00-- 0-0- -00-"},
+    {0x403560000ULL, "-001 0-10 01-0 100-"},
+    {0x403570000ULL, "-00- 0--0"},
+    {0x403580000ULL, "0011 01-0 100-"},
+    {0x403590000ULL, "0011 0-00 01-0 100-"},
+    {0x4035a0000ULL, "00-1 01-0 100-"},
+    {0x4035b0000ULL, "00-1 01-0 -00-"},
+    {0x4035e0000ULL, "00-1 001- 01-0 100-"},
+    {0x4035f0000ULL, "00-- -00- 0--0"},
+    {0x403680000ULL, "0011 0101 0110 100-"},
+    {0x403690000ULL, "0011 0101 0110 -000 100-"},
+    {0x4036a0000ULL, "0110 00-1 0-01 100-"},
+    {0x4036b0000ULL, "0110 00-1 0-01 -00-"},
+    {0x4036c0000ULL, "0101 001- 0-10 100-"},
+    {0x4036d0000ULL, "0101 00-0 001- 0-10 100-"},
+    {0x4036e0000ULL, "00-1 0-01 0-10 100-"},
+    {0x4036f0000ULL, "0-01 0-10 00-- -00-"},
+    {0x4037c0000ULL, "001- 0-10 010- 100-"},
+    {0x4037d0000ULL, "001- 010- 100- 0--0"},
+    {0x4037e0000ULL, "00-1 0-10 010- 100-"},
+    {0x4037f0000ULL, "00-- 0-0- -00- 0--0"},
+    {0x403c00000ULL, "100- 011-"},
+    {0x403c10000ULL, "-000 100- 011-"},
+    {0x403c30000ULL, "011- -00-"},
+    {0x403c50000ULL, "00-0 100- 011-"},
+    {0x403c60000ULL, "-001 0-10 100- 011-"},
+    {0x403c70000ULL, "00-0 011- -00-"},
+    {0x403cf0000ULL, "-00- 0-1-"},
+    {0x403d40000ULL, "0-10 01-0 100- 011-"},
+    {0x403d50000ULL, "100- 011- 0--0"},
+    {0x403d60000ULL, "-001 0-10 01-0 100- 011-"},
+    {0x403d70000ULL, "011- -00- 0--0"},
+    {0x403d80000ULL, "01-0 100- 0-11"},
+    {0x403d90000ULL, "0-00 01-0 100- 0-11"},
+    {0x403db0000ULL, "01-0 0-11 -00-"},
+    {0x403dc0000ULL, "01-0 100- 0-1-"},
+    {0x403dd0000ULL, "100- 0--0 0-1-"},
+    {0x403de0000ULL, "00-1 01-0 100- 0-1-"},
+    {0x403df0000ULL, "-00- 0--0 0-1-"},
+    {0x403fc0000ULL, "100- 0-1- 01--"},
+    {0x403fd0000ULL, "100- 0--0 0-1- 01--"},
+    {0x403ff0000ULL, "-00- 0---"},
+    {0x406600000ULL, "0101 0110 1001 1010"},
+    {0x406610000ULL, "0000 0101 0110 1001 1010"},
+    {0x406620000ULL, "0110 1010 0-01 -001"},
+    {0x406630000ULL, "0110 1010 000- 0-01 -001"},
+    {0x406660000ULL, "0-01 -001 0-10 -010"},
+    {0x406670000ULL, "000- 0-01 -001 0-10 -010"},
+    {0x406690000ULL, "0000 0011 0101 0110 1001 1010"},
+    {0x4066b0000ULL, "0110 1010 000- 00-1 0-01 -001"},
+    {0x4066f0000ULL, "0-01 -001 0-10 -010 00--"},
+    {0x406720000ULL, "1010 0-01 -001 01-0"},
+    {0x406730000ULL, "1010 -001 01-0 0-0-"},
+    {0x406760000ULL, "0-01 -001 -010 01-0"},
+    {0x406770000ULL, "-001 -010 0-0- 0--0"},
+    {0x406780000ULL, "0011 1001 1010 010- 01-0"},
+    {0x406790000ULL, "0011 1001 1010 0-00 010- 01-0"},
+    {0x4067a0000ULL, "1010 00-1 0-01 -001 01-0"},
+    {0x4067b0000ULL, "1010 00-1 -001 01-0 0-0-"},
+    {0x4067e0000ULL, "00-1 0-01 -001 -010 01-0"},
+    {0x4067f0000ULL, "-001 -010 00-- 0-0- 0--0"},
+    {0x406900000ULL, "0100 1001 1010 0111"},
+    {0x406910000ULL, "1001 1010 0111 0-00"},
+    {0x406930000ULL, "1010 0111 0-00 -001"},
+    {0x406960000ULL, "0100 0111 -001 -010"},
+    {0x406970000ULL, "0111 0-00 -001 -010"},
+    {0x4069f0000ULL, "0-00 -001 -010 0-11"},
+    {0x406b00000ULL, "1001 1010 010- 01-1"},
+    {0x406b10000ULL, "1001 1010 0-00 01-1"},
+    {0x406b20000ULL, "1010 -001 010- 01-1"},
+    {0x406b30000ULL, "1010 -001 01-1 0-0-"},
+    {0x406b40000ULL, "1001 -010 010- 01-1"},
+    {0x406b50000ULL, "1001 0-00 -010 01-1"},
+    {0x406b60000ULL, "-001 -010 010- 01-1"},
+    {0x406b70000ULL, "-001 -010 01-1 0-0-"},
+    {0x406b90000ULL, "1001 1010 0-00 010- 0-11"},
+    {0x406bb0000ULL, "1010 -001 0-0- 0--1"},
+    {0x406bd0000ULL, "1001 00-0 -010 010- 0-11"},
+    {0x406bf0000ULL, "-001 -010 0-0- 0--1"},
+    {0x406f00000ULL, "1001 1010 01--"},
+    {0x406f10000ULL, "1001 1010 0-00 01--"},
+    {0x406f20000ULL, "1010 -001 01--"},
+    {0x406f30000ULL, "1010 -001 0-0- 01--"},
+    {0x406f60000ULL, "-001 -010 01--"},
+    {0x406f70000ULL, "-001 -010 0-0- 01--"},
+    {0x406f90000ULL, "1001 1010 0-00 0-11 01--"},
+    {0x406fb0000ULL, "1010 -001 0-0- 0--1 01--"},
+    {0x406ff0000ULL, "-001 -010 0---"},
+    {0x407760000ULL, "0-01 -010 01-0 100-"},
+    {0x407770000ULL, "0-0- -00- 0--0 -0-0"},
+    {0x407780000ULL, "0011 010- 01-0 100- 10-0"},
+    {0x407790000ULL, "0011 0-00 010- 01-0 100- 10-0"},
+    {0x4077a0000ULL, "00-1 0-01 -001 01-0 10-0"},
+    {0x4077b0000ULL, "00-1 01-0 10-0 0-0- -00-"},
+    {0x4077e0000ULL, "00-1 0-01 -010 01-0 100-"},
+    {0x4077f0000ULL, "00-- 0-0- -00- 0--0 -0-0"},
+    {0x407b00000ULL, "010- 100- 10-0 01-1"},
+    {0x407b10000ULL, "0-00 100- 10-0 01-1"},
+    {0x407b30000ULL, "10-0 01-1 0-0- -00-"},
+    {0x407b40000ULL, "-010 010- 100- 01-1"},
+    {0x407b50000ULL, "0-00 100- 01-1 -0-0"},
+    {0x407b60000ULL, "0-01 -010 010- 100- 01-1"},
+    {0x407b70000ULL, "01-1 0-0- -00- -0-0"},
+    {0x407bc0000ULL, "-010 010- 100- 0-11"},
+    {0x407bd0000ULL, "010- 100- 0-11 -0-0"},
+    {0x407bf0000ULL, "0-0- -00- -0-0 0--1"},
+    {0x407e00000ULL, "100- 10-0 01-1 011-"},
+    {0x407e10000ULL, "-000 100- 10-0 01-1 011-"},
+    {0x407e20000ULL, "0-01 -001 10-0 011-"},
+    {0x407e30000ULL, "0-01 10-0 011- -00-"},
+    {0x407e60000ULL, "0-01 -010 100- 011-"},
+    {0x407e70000ULL, "0-01 011- -00- -0-0"},
+    {0x407e90000ULL, "-000 100- 10-0 0-11 01-1 011-"},
+    {0x407eb0000ULL, "10-0 011- -00- 0--1"},
+    {0x407ef0000ULL, "-00- -0-0 0--1 0-1-"},
+    {0x407f00000ULL, "100- 10-0 01--"},
+    {0x407f10000ULL, "0-00 100- 10-0 01--"},
+    {0x407f20000ULL, "-001 10-0 01--"},
+    {0x407f30000ULL, "10-0 -00- 01--"},
+    {0x407f60000ULL, "0-01 -010 100- 01--"},
+    {0x407f70000ULL, "-00- -0-0 01--"},
+    {0x407f80000ULL, "100- 10-0 0-11 01--"},
+    {0x407f90000ULL, "0-00 100- 10-0 0-11 01--"},
+    {0x407fa0000ULL, "-001 10-0 0--1 01--"},
+    {0x407fb0000ULL, "10-0 -00- 0--1 01--"},
+    {0x407fe0000ULL, "-001 10-0 0-1- 01--"},
+    {0x407ff0000ULL, "-00- -0-0 0---"},
+    {0x40ff00000ULL, "01-- 10--"},
+    {0x40ff10000ULL, "0-00 01-- 10--"},
+    {0x40ff30000ULL, "0-0- 01-- 10--"},
+    {0x40ff60000ULL, "0-01 0-10 01-- 10--"},
+    {0x40ff70000ULL, "0-0- 0--0 01-- 10--"},
+    {0x40fff0000ULL, "0--- -0--"},
+    {0x416680000ULL, "0011 0101 0110 1001 1010 1100"},
+    {0x416690000ULL, "0000 0011 0101 0110 1001 1010 1100"},
+    {0x4166a0000ULL, "0110 1010 1100 00-1 0-01 -001"},
+    {0x4166b0000ULL, "0110 1010 1100 000- 00-1 0-01 -001"},
+    {0x4166e0000ULL, "1100 00-1 0-01 -001 0-10 -010"},
+    {0x4166f0000ULL, "1100 0-01 -001 0-10 -010 00--"},
+    {0x4167e0000ULL, "00-1 0-01 -001 0-10 -010 -100"},
+    {0x4167f0000ULL, "-001 -010 -100 00-- 0-0- 0--0"},
+    {0x416810000ULL, "0000 1001 1010 1100 0111"},
+    {0x416830000ULL, "1010 1100 0111 000- -001"},
+    {0x416860000ULL, "1100 0111 -001 -010"},
+    {0x416870000ULL, "1100 0111 000- -001 -010"},
+    {0x416890000ULL, "0000 1001 1010 1100 0-11"},
+    {0x4168b0000ULL, "1010 1100 000- -001 0-11"},
+    {0x4168e0000ULL, "1100 -001 -010 0-11"},
+    {0x4168f0000ULL, "1100 -001 -010 0-11 00--"},
+    {0x416960000ULL, "0111 -001 -010 -100"},
+    {0x416970000ULL, "0111 000- -001 -010 -100"},
+    {0x416980000ULL, "1001 1010 -100 0-11"},
+    {0x416990000ULL, "1001 1010 0-00 -100 0-11"},
+    {0x4169a0000ULL, "1010 -001 -100 0-11"},
+    {0x4169b0000ULL, "1010 000- -001 -100 0-11"},
+    {0x4169e0000ULL, "-001 -010 -100 0-11"},
+    {0x4169f0000ULL, "-001 -010 -100 0-11 00--"},
+    {0x416a90000ULL, "0000 1001 1010 1100 0-11 01-1"},
+    {0x416ab0000ULL, "1010 1100 000- -001 0--1"},
+    {0x416ac0000ULL, "1001 1100 001- -010 01-1"},
+    {0x416ad0000ULL, "1001 1100 00-0 001- -010 01-1"},
+    {0x416ae0000ULL, "1100 -001 -010 0--1"},
+    {0x416af0000ULL, "1100 -001 -010 00-- 0--1"},
+    {0x416bc0000ULL, "1001 001- -010 -100 01-1"},
+    {0x416bd0000ULL, "1001 00-0 001- -010 -100 01-1"},
+    {0x416be0000ULL, "-001 -010 -100 0--1"},
+    {0x416bf0000ULL, "-001 -010 -100 00-- 0--1"},
+    {0x416e90000ULL, "0000 1001 1010 1100 0-11 01-1 011-"},
+    {0x416ea0000ULL, "1010 1100 -001 011- 0--1"},
+    {0x416eb0000ULL, "1010 1100 000- -001 011- 0--1"},
+    {0x416ee0000ULL, "1100 -001 -010 0--1 0-1-"},
+    {0x416ef0000ULL, "1100 -001 -010 00-- 0--1 0-1-"},
+    {0x416fe0000ULL, "-001 -010 -100 0--1 0-1-"},
+    {0x416ff0000ULL, "-001 -010 -100 0---"},
+    {0x4177e0000ULL, "00-1 0-01 -001 0-10 -100 10-0"},
+    {0x4177f0000ULL, "00-- 0-0- -00- 0--0 -0-0 --00"},
+    {0x417810000ULL, "0111 -000 100- 10-0 1-00"},
+    {0x417830000ULL, "0111 10-0 1-00 -00-"},
+    {0x417870000ULL, "0111 1-00 -00- -0-0"},
+    {0x417890000ULL, "-000 100- 10-0 1-00 0-11"},
+    {0x4178b0000ULL, "10-0 1-00 0-11 -00-"},
+    {0x4178e0000ULL, "-001 -010 1-00 0-11"},
+    {0x4178f0000ULL, "1-00 0-11 -00- -0-0"},
+    {0x417960000ULL, "0111 -001 -010 -100 100-"},
+    {0x417970000ULL, "0111 -00- -0-0 --00"},
+    {0x417980000ULL, "-100 100- 10-0 0-11"},
+    {0x417990000ULL, "100- 10-0 0-11 --00"},
+    {0x4179a0000ULL, "-001 -100 10-0 0-11"},
+    {0x4179b0000ULL, "10-0 0-11 -00- --00"},
+    {0x4179e0000ULL, "00-1 -010 -100 100- 0-11"},
+    {0x4179f0000ULL, "0-11 -00- -0-0 --00"},
+    {0x417a90000ULL, "-000 100- 10-0 1-00 0-11 01-1"},
+    {0x417ab0000ULL, "10-0 1-00 -00- 0--1"},
+    {0x417ac0000ULL, "001- -010 100- 1-00 01-1"},
+    {0x417ad0000ULL, "001- 100- 1-00 01-1 -0-0"},
+    {0x417ae0000ULL, "-001 -010 1-00 0--1"},
+    {0x417af0000ULL, "1-00 -00- -0-0 0--1"},
+    {0x417bc0000ULL, "001- -010 -100 100- 01-1"},
+    {0x417bd0000ULL, "001- 100- 01-1 -0-0 --00"},
+    {0x417be0000ULL, "-010 -100 100- 0--1"},
+    {0x417bf0000ULL, "-00- -0-0 --00 0--1"},
+    {0x417e80000ULL, "100- 10-0 1-00 0-11 01-1 011-"},
+    {0x417e90000ULL, "-000 100- 10-0 1-00 0-11 01-1 011-"},
+    {0x417ea0000ULL, "-001 10-0 1-00 011- 0--1"},
+    {0x417eb0000ULL, "10-0 1-00 011- -00- 0--1"},
+    {0x417ee0000ULL, "-001 -010 1-00 0--1 0-1-"},
+    {0x417ef0000ULL, "1-00 -00- -0-0 0--1 0-1-"},
+    {0x417fe0000ULL, "-001 -010 1-00 0--1 01--"},
+    {0x417ff0000ULL, "-00- -0-0 --00 0---"},
+    {0x418e70000ULL, "1100 1011 000- 0-10 01-1"},
+    {0x418ef0000ULL, "1100 -011 00-- 0--1 0-1-"},
+    {0x418ff0000ULL, "-100 -011 0---"},
+    {0x419e10000ULL, "1011 -000 1-00 01-1 011-"},
+    {0x419e30000ULL, "1011 000- 0-01 1-00 011-"},
+    {0x419e60000ULL, "1011 0-01 0-10 1-00 01-1"},
+    {0x419e70000ULL, "1011 000- 0-10 1-00 01-1"},
+    {0x419e90000ULL, "-000 1-00 -011 01-1 011-"},
+    {0x419ea0000ULL, "1-00 -011 011- 0--1"},
+    {0x419eb0000ULL, "000- 1-00 -011 011- 0--1"},
+    {0x419ee0000ULL, "1-00 -011 0--1 0-1-"},
+    {0x419ef0000ULL, "1-00 -011 00-- 0--1 0-1-"},
+    {0x419f10000ULL, "1011 --00 01--"},
+    {0x419f30000ULL, "1011 0-0- --00 01--"},
+    {0x419f60000ULL, "1011 0-01 0-10 1-00 01--"},
+    {0x419f70000ULL, "1011 0-0- 0--0 --00 01--"},
+    {0x419f80000ULL, "1-00 -011 01--"},
+    {0x419f90000ULL, "-011 --00 01--"},
+    {0x419fa0000ULL, "1-00 -011 0--1 01--"},
+    {0x419fb0000ULL, "-011 0-0- --00 01--"},
+    {0x419fe0000ULL, "1-00 -011 0--1 0-1- 01--"},
+    {0x419ff0000ULL, "-011 --00 0---"},
+    {0x41bd60000ULL, "-001 0-10 01-0 1-00 011- 10-1"},
+    {0x41bd70000ULL, "011- 10-1 -00- 0--0 --00"},
+    {0x41bd80000ULL, "01-0 1-00 0-11 10-1"},
+    {0x41bd90000ULL, "01-0 0-11 10-1 --00"},
+    {0x41bdb0000ULL, "011- --00 -0-1"},
+    {0x41bde0000ULL, "01-0 1-00 -0-1 0-1-"},
+    {0x41bdf0000ULL, "--00 -0-1 0-1-"},
+    {0x41be40000ULL, "0-10 1-00 01-1 10-1"},
+    {0x41be50000ULL, "00-0 0-10 1-00 01-1 10-1"},
+    {0x41be70000ULL, "0-10 1-00 01-1 10-1 -00-"},
+    {0x41bec0000ULL, "1-00 01-1 10-1 0-1-"},
+    {0x41bed0000ULL, "00-0 1-00 01-1 10-1 0-1-"},
+    {0x41bee0000ULL, "1-00 0--1 -0-1 0-1-"},
+    {0x41bef0000ULL, "1-00 00-- 0--1 -0-1 0-1-"},
+    {0x41bfc0000ULL, "1-00 10-1 0-1- 01--"},
+    {0x41bfd0000ULL, "10-1 --00 0-1- 01--"},
+    {0x41bff0000ULL, "--00 -0-1 0---"},
+    {0x41ee10000ULL, "0000 1100 01-1 011- 10-1 101-"},
+    {0x41ee30000ULL, "1100 000- 0-01 -001 011- 101-"},
+    {0x41ee60000ULL, "1100 0-01 -010 011- 10-1"},
+    {0x41ee70000ULL, "1100 000- 0-01 -010 011- 10-1"},
+    {0x41ee90000ULL, "0000 1100 0-11 01-1 011- 10-1 101-"},
+    {0x41eeb0000ULL, "1100 000- 011- 101- 0--1 -0-1"},
+    {0x41eee0000ULL, "1100 0--1 -0-1 0-1- -01-"},
+    {0x41eef0000ULL, "1100 00-- 0--1 -0-1 0-1- -01-"},
+    {0x41ef10000ULL, "0-00 -100 10-1 101- 01--"},
+    {0x41ef30000ULL, "-001 -100 101- 0-0- 01--"},
+    {0x41ef60000ULL, "0-01 -010 -100 10-1 01--"},
+    {0x41ef70000ULL, "-001 -100 101- 0--0 01--"},
+    {0x41ef90000ULL, "0-00 -100 0-11 10-1 101- 01--"},
+    {0x41efa0000ULL, "-100 101- -0-1 01--"},
+    {0x41efb0000ULL, "-100 101- 0-0- -0-1 01--"},
+    {0x41efe0000ULL, "-100 -0-1 -01- 01--"},
+    {0x41eff0000ULL, "-100 -0-1 -01- 0---"},
+    {0x41ff10000ULL, "--00 01-- 10--"},
+    {0x41ff20000ULL, "0-01 -100 01-- 10--"},
+    {0x41ff30000ULL, "0-0- --00 01-- 10--"},
+    {0x41ff60000ULL, "0-01 0-10 -100 01-- 10--"},
+    {0x41ff70000ULL, "0-0- 0--0 --00 01-- 10--"},
+    {0x41ff80000ULL, "-100 0-11 01-- 10--"},
+    {0x41ff90000ULL, "0-11 --00 01-- 10--"},
+    {0x41ffa0000ULL, "-100 0--1 01-- 10--"},
+    {0x41ffb0000ULL, "--00 0--1 01-- 10--"},
+    {0x41ffe0000ULL, "-100 0--1 0-1- 10--"},
+    {0x41fff0000ULL, "--00 0--- -0--"},
+    {0x43cc30000ULL, "000- 011- 101- 110-"},
+    {0x43cc70000ULL, "000- 00-0 011- 101- 110-"},
+    {0x43ccf0000ULL, "110- 00-- 0-1- -01-"},
+    {0x43cd70000ULL, "000- 011- 101- 110- 0--0"},
+    {0x43cdb0000ULL, "000- 01-0 0-11 101- 110-"},
+    {0x43cdf0000ULL, "110- 00-- 0--0 0-1- -01-"},
+    {0x43cff0000ULL, "-01- -10- 0---"},
+    {0x43dd60000ULL, "0001 0-10 01-0 10-0 011- 101- 110-"},
+    {0x43dd70000ULL, "000- 011- 101- 110- 0--0 -0-0"},
+    {0x43dda0000ULL, "00-1 01-0 10-0 0-11 -011 110-"},
+    {0x43ddb0000ULL, "00-1 011- 101- 110- --00"},
+    {0x43dde0000ULL, "00-1 01-0 10-0 110- 0-1- -01-"},
+    {0x43ddf0000ULL, "110- 00-- --00 0-1- -01-"},
+    {0x43ded0000ULL, "1-00 -101 -0-0 0-1- -01-"},
+    {0x43def0000ULL, "110- -0-0 0--1 0-1- -01-"},
+    {0x43dfd0000ULL, "-0-0 0-1- -01- -10-"},
+    {0x43dfe0000ULL, "10-0 0--1 0-1- -01- -10-"},
+    {0x43dff0000ULL, "-0-0 -01- -10- 0---"},
+    {0x43ffc0000ULL, "0-1- -10- 10--"},
+    {0x43ffd0000ULL, "0--0 0-1- -10- 10--"},
+    {0x43fff0000ULL, "0--- -0-- --0-"},
+    {0x469960000ULL, "0001 0010 0100 1000 0111 1011 1101 1110"},
+    {0x469970000ULL, "0111 1011 1101 1110 000- 00-0 0-00 -000"},
+    {0x4699f0000ULL, "1101 1110 0-00 -000 0-11 -011 00--"},
+    {0x469bf0000ULL, "1110 -000 -011 -101 00-- 0-0- 0--1"},
+    {0x469ff0000ULL, "-000 -011 -101 -110 0---"},
+    {0x46bbd0000ULL, "1110 00-0 0-00 -000 0-11 -101 10-1"},
+    {0x46bbf0000ULL, "1110 00-- 0-0- -00- 0--1 -0-1 --01"},
+    {0x46bd60000ULL, "-001 0-10 01-0 100- 011- -110 10-1 1-01"},
+    {0x46bd70000ULL, "011- -110 10-1 1-01 -00- 0--0"},
+    {0x46bdf0000ULL, "-110 1-01 -00- 0--0 -0-1 0-1-"},
+    {0x46bfd0000ULL, "-000 -011 -110 1-01 0--0 01--"},
+    {0x46bff0000ULL, "-110 -00- -0-1 --01 0---"},
+    {0x46ff60000ULL, "--01 --10 01-- 10--"},
+    {0x46ff70000ULL, "0-0- --01 --10 01-- 10--"},
+    {0x46ff90000ULL, "0-00 0-11 -101 -110 10--"},
+    {0x46ffb0000ULL, "-110 0-0- 0--1 --01 10--"},
+    {0x46fff0000ULL, "--01 --10 0--- -0--"},
+    {0x47eff0000ULL, "-0-1 --10 -10- 0---"},
+    {0x47ffe0000ULL, "0--1 -01- -1-0 1-0-"},
+    {0x47fff0000ULL, "0--- -0-- --0- ---0"},
+    {0x4ffff0000ULL, "----"},
+};
+
+constexpr int NP_TABLE_SIZE = 696;
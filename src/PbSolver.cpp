@@ -0,0 +1,632 @@
+#include "PbSolver.h"
+#include "Console.h"
+#include "BranchAndBound.h"
+#include "GreedyCover.h"
+#include <algorithm>
+#include <climits>
+#include <iostream>
+#include <map>
+
+// ==================== PbOptimizer Implementation ====================
+
+const int PbOptimizer::NO_REASON;
+const int PbOptimizer::BOUND_REASON;
+
+// Luby restart sequence: 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ...
+static long long luby(long long i) {
+    long long size = 1;
+    int seq = 0;
+    while (size < i + 1) {
+        seq++;
+        size = 2 * size + 1;
+    }
+    while (size - 1 != i) {
+        size = (size - 1) >> 1;
+        seq--;
+        i = i % size;
+    }
+    return 1LL << seq;
+}
+
+PbOptimizer::PbOptimizer(const std::vector<long long>& weights)
+    : num_vars(weights.size()), weight(weights), qhead(0), bound(0), true_weight(0),
+      activity_inc(1.0), unsat_at_root(false),
+      conflicts(0), decisions(0), learnt_clauses(0), restarts(0) {
+
+    watches.resize(2 * num_vars);
+    value.assign(num_vars, -1);
+    level.assign(num_vars, 0);
+    reason.assign(num_vars, NO_REASON);
+    trail_pos.assign(num_vars, 0);
+    activity.assign(num_vars, 0.0);
+
+    for (int v = 0; v < num_vars; v++) {
+        by_weight.push_back(v);
+    }
+    std::stable_sort(by_weight.begin(), by_weight.end(), [this](int a, int b) {
+        return weight[a] > weight[b];
+    });
+}
+
+int PbOptimizer::litValue(int lit) const {
+    signed char v = value[var(lit)];
+    if (v < 0) return -1;
+    return (lit & 1) ? 1 - v : v;
+}
+
+void PbOptimizer::enqueue(int lit, int from) {
+    int v = var(lit);
+    value[v] = (lit & 1) ? 0 : 1;
+    level[v] = decisionLevel();
+    reason[v] = from;
+    trail_pos[v] = trail.size();
+    trail.push_back(lit);
+
+    if (value[v] == 1) {
+        true_weight += weight[v];
+    }
+}
+
+void PbOptimizer::addClause(const std::vector<int>& lits) {
+    std::vector<int> c = lits;
+    std::sort(c.begin(), c.end());
+    c.erase(std::unique(c.begin(), c.end()), c.end());
+
+    if (c.empty()) {
+        unsat_at_root = true;
+        return;
+    }
+
+    // Covering clauses seed the activities: PIs in many clauses go first
+    for (int lit : c) {
+        activity[var(lit)] += 1.0;
+    }
+
+    if (c.size() == 1) {
+        int val = litValue(c[0]);
+        if (val == 0) {
+            unsat_at_root = true;
+        } else if (val < 0) {
+            enqueue(c[0], NO_REASON);
+        }
+        return;
+    }
+
+    int index = addClauseInternal(c);
+    if (std::all_of(c.begin(), c.end(), [](int lit) { return !(lit & 1); })) {
+        cover_clauses.push_back(index);
+    }
+}
+
+int PbOptimizer::addClauseInternal(const std::vector<int>& lits) {
+    int index = clauses.size();
+    clauses.push_back(lits);
+    watches[lits[0]].push_back(index);
+    watches[lits[1]].push_back(index);
+    return index;
+}
+
+int PbOptimizer::propagate() {
+    while (qhead < trail.size()) {
+        int lit = trail[qhead++];
+
+        // A PI became selected: check the objective bound
+        if (!(lit & 1)) {
+            int conflict = propagateBound();
+            if (conflict != -1) {
+                return conflict;
+            }
+        }
+
+        // Visit the clauses watching the literal that just became false
+        int false_lit = neg(lit);
+        std::vector<int>& ws = watches[false_lit];
+        size_t i = 0;
+        size_t j = 0;
+
+        while (i < ws.size()) {
+            int ci = ws[i++];
+            std::vector<int>& c = clauses[ci];
+
+            // Keep the false watch in c[1]
+            if (c[0] == false_lit) {
+                std::swap(c[0], c[1]);
+            }
+
+            if (litValue(c[0]) == 1) {
+                ws[j++] = ci;  // Clause already satisfied
+                continue;
+            }
+
+            // Look for a new literal to watch
+            bool moved = false;
+            for (size_t k = 2; k < c.size(); k++) {
+                if (litValue(c[k]) != 0) {
+                    std::swap(c[1], c[k]);
+                    watches[c[1]].push_back(ci);
+                    moved = true;
+                    break;
+                }
+            }
+            if (moved) {
+                continue;
+            }
+
+            ws[j++] = ci;
+            if (litValue(c[0]) == 0) {
+                // Every literal is false: conflict
+                while (i < ws.size()) {
+                    ws[j++] = ws[i++];
+                }
+                ws.resize(j);
+                qhead = trail.size();
+                return ci;
+            }
+
+            enqueue(c[0], ci);  // Unit clause
+        }
+        ws.resize(j);
+    }
+
+    return -1;
+}
+
+int PbOptimizer::propagateBound() {
+    if (true_weight > bound) {
+        return conflictFromBound();
+    }
+
+    // Any unassigned variable heavier than the slack must stay 0
+    long long slack = bound - true_weight;
+    for (int u : by_weight) {
+        if (weight[u] <= slack) {
+            break;
+        }
+        if (value[u] < 0) {
+            enqueue(2 * u + 1, BOUND_REASON);
+        }
+    }
+
+    return -1;
+}
+
+int PbOptimizer::conflictFromBound() {
+    // Heaviest true variables first, until together they break the bound
+    std::vector<int> lits;
+    long long sum = 0;
+
+    for (int u : by_weight) {
+        if (value[u] == 1) {
+            lits.push_back(2 * u + 1);
+            sum += weight[u];
+            if (sum > bound) break;
+        }
+    }
+
+    // Stored like a learnt clause; it stays valid because the bound only
+    // ever decreases. Its literals are all false, so it is not watched.
+    int index = clauses.size();
+    clauses.push_back(lits);
+    qhead = trail.size();
+    return index;
+}
+
+void PbOptimizer::explainBound(int lit, std::vector<int>& out) const {
+    // x[q] was forced to 0 because the variables already true when it was
+    // assigned, plus weight[q], exceed the bound
+    int q = var(lit);
+    out.clear();
+    out.push_back(lit);
+
+    long long sum = weight[q];
+    for (int u : by_weight) {
+        if (value[u] == 1 && trail_pos[u] < trail_pos[q]) {
+            out.push_back(2 * u + 1);
+            sum += weight[u];
+            if (sum > bound) break;
+        }
+    }
+}
+
+int PbOptimizer::lowerBoundConflict() {
+    std::vector<char> used(num_vars, 0);
+    std::vector<int> chosen;
+    long long needed = 0;
+
+    for (int ci : cover_clauses) {
+        const std::vector<int>& c = clauses[ci];
+        bool satisfied = false;
+        bool disjoint = true;
+        long long cheapest = LLONG_MAX;
+
+        for (int lit : c) {
+            int v = var(lit);
+            if (value[v] == 1) {
+                satisfied = true;
+                break;
+            }
+            if (value[v] < 0) {
+                if (used[v]) disjoint = false;
+                cheapest = std::min(cheapest, weight[v]);
+            }
+        }
+        if (satisfied || !disjoint || cheapest == LLONG_MAX) continue;
+
+        for (int lit : c) {
+            if (value[var(lit)] < 0) used[var(lit)] = 1;
+        }
+        needed += cheapest;
+        chosen.push_back(ci);
+    }
+
+    if (true_weight + needed <= bound) {
+        return -1;
+    }
+
+    // Reason: the variables ruled out of the chosen clauses, plus enough of
+    // the selected weight to go over the bound
+    std::vector<int> lits;
+    for (int ci : chosen) {
+        for (int lit : clauses[ci]) {
+            if (value[var(lit)] == 0) lits.push_back(lit);
+        }
+    }
+    long long sum = needed;
+    for (int u : by_weight) {
+        if (sum > bound) break;
+        if (value[u] == 1) {
+            lits.push_back(2 * u + 1);
+            sum += weight[u];
+        }
+    }
+    std::sort(lits.begin(), lits.end());
+    lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+
+    int index = clauses.size();
+    clauses.push_back(lits);
+    return index;
+}
+
+void PbOptimizer::reasonLits(int v, std::vector<int>& out) const {
+    if (reason[v] == BOUND_REASON) {
+        explainBound(value[v] ? 2 * v : 2 * v + 1, out);
+    } else {
+        out = clauses[reason[v]];
+    }
+}
+
+void PbOptimizer::analyze(int conflict, std::vector<int>& learnt, int& backjump_level) {
+    // First-UIP: resolve backwards along the trail until only one literal
+    // of the current decision level is left
+    std::vector<char> seen(num_vars, 0);
+    std::vector<int> lits = clauses[conflict];
+    learnt.assign(1, -1);
+
+    int counter = 0;
+    int p = -1;
+    int idx = trail.size() - 1;
+
+    do {
+        for (int q : lits) {
+            int v = var(q);
+            if (p != -1 && v == var(p)) continue;
+            if (seen[v] || level[v] == 0) continue;
+
+            seen[v] = 1;
+            bumpActivity(v);
+            if (level[v] >= decisionLevel()) {
+                counter++;
+            } else {
+                learnt.push_back(q);
+            }
+        }
+
+        while (!seen[var(trail[idx])]) {
+            idx--;
+        }
+        p = trail[idx];
+        idx--;
+        seen[var(p)] = 0;
+        counter--;
+
+        if (counter > 0) {
+            reasonLits(var(p), lits);
+        }
+    } while (counter > 0);
+
+    learnt[0] = neg(p);
+
+    // Backjump to the second highest level in the learnt clause
+    backjump_level = 0;
+    for (size_t i = 1; i < learnt.size(); i++) {
+        if (level[var(learnt[i])] > backjump_level) {
+            backjump_level = level[var(learnt[i])];
+            std::swap(learnt[1], learnt[i]);
+        }
+    }
+}
+
+void PbOptimizer::backtrack(int target_level) {
+    if (decisionLevel() <= target_level) {
+        return;
+    }
+
+    size_t keep = trail_lim[target_level];
+    for (size_t i = trail.size(); i > keep; i--) {
+        int v = var(trail[i - 1]);
+        if (value[v] == 1) {
+            true_weight -= weight[v];
+        }
+        value[v] = -1;
+        reason[v] = NO_REASON;
+    }
+
+    trail.resize(keep);
+    trail_lim.resize(target_level);
+    qhead = trail.size();
+}
+
+void PbOptimizer::bumpActivity(int v) {
+    activity[v] += activity_inc;
+    if (activity[v] > 1e100) {
+        for (double& a : activity) a *= 1e-100;
+        activity_inc *= 1e-100;
+    }
+}
+
+int PbOptimizer::pickBranchVar() const {
+    int best = -1;
+    for (int v = 0; v < num_vars; v++) {
+        if (value[v] < 0 && (best < 0 || activity[v] > activity[best])) {
+            best = v;
+        }
+    }
+    return best;
+}
+
+bool PbOptimizer::minimize(long long initial_bound, std::vector<int>& best, long long& best_cost,
+                           const CoverBudget& budget) {
+    if (unsat_at_root) {
+        return true;
+    }
+
+    bound = initial_bound;
+    qhead = 0;  // Check the bound against the root assignments too
+
+    std::stable_sort(cover_clauses.begin(), cover_clauses.end(), [this](int a, int b) {
+        return clauses[a].size() < clauses[b].size();
+    });
+
+    long long restart_index = 0;
+    long long conflicts_to_restart = luby(restart_index) * 64;
+    std::vector<int> learnt;
+
+    while (true) {
+        int conflict = propagate();
+        if (conflict == -1) {
+            conflict = lowerBoundConflict();
+        }
+
+        if (conflict != -1) {
+            conflicts++;
+
+            // A lower-bound conflict may only involve earlier levels
+            int conflict_level = 0;
+            for (int lit : clauses[conflict]) {
+                conflict_level = std::max(conflict_level, level[var(lit)]);
+            }
+            if (conflict_level == 0) {
+                return true;  // Nothing cheaper than the bound exists
+            }
+            backtrack(conflict_level);
+
+            int backjump_level;
+            analyze(conflict, learnt, backjump_level);
+            backtrack(backjump_level);
+
+            if (learnt.size() == 1) {
+                enqueue(learnt[0], NO_REASON);
+            } else {
+                int ci = addClauseInternal(learnt);
+                enqueue(learnt[0], ci);
+            }
+            learnt_clauses++;
+            activity_inc /= 0.95;
+
+            if (--conflicts_to_restart <= 0) {
+                restarts++;
+                backtrack(0);
+                conflicts_to_restart = luby(++restart_index) * 64;
+            }
+
+            if ((conflicts & 255) == 0 && budget.timeExpired()) {
+                return false;
+            }
+            continue;
+        }
+
+        int v = pickBranchVar();
+
+        if (v < 0) {
+            // Every variable is assigned and no clause is violated
+            best.clear();
+            for (int u = 0; u < num_vars; u++) {
+                if (value[u] == 1) best.push_back(u);
+            }
+            best_cost = true_weight;
+
+            // Now look for anything strictly cheaper
+            bound = best_cost - 1;
+            backtrack(0);
+            qhead = 0;
+            continue;
+        }
+
+        decisions++;
+        if ((decisions & 1023) == 0 && budget.timeExpired()) {
+            return false;
+        }
+
+        // Try leaving the PI out first; covering clauses pull PIs back in
+        trail_lim.push_back(trail.size());
+        enqueue(2 * v + 1, NO_REASON);
+    }
+}
+
+// ==================== PbCoverSolver Implementation ====================
+
+PbCoverSolver::PbCoverSolver()
+    : proven(true), lower_bound(0),
+      conflicts(0), decisions(0), learnt_clauses(0), restarts(0) {
+}
+
+void PbCoverSolver::solve(const std::vector<Implicant>& pis,
+                          const std::vector<int>& minterms,
+                          const std::vector<int>& dont_cares) {
+    essential_pi_indices.clear();
+    additional_pi_indices.clear();
+
+    LOG(SUMMARY) << "\n[Step 4] Pseudo-Boolean Covering (CDCL)\n";
+    chart.build(pis, minterms, dont_cares);
+
+    for (const auto& epi : chart.findEssentialPIs()) {
+        essential_pi_indices.push_back(epi.pi_index);
+    }
+    LOG(SUMMARY) << "  ✓ Essential PIs: " << essential_pi_indices.size() << "\n";
+
+    std::vector<int> remaining = chart.getRemainingMinterms(essential_pi_indices);
+    LOG(SUMMARY) << "  ✓ Remaining minterms: " << remaining.size() << "\n";
+
+    proven = true;
+    lower_bound = essential_pi_indices.size();
+    if (remaining.empty()) {
+        return;
+    }
+
+    // One covering clause per remaining minterm
+    std::vector<PetrickTerm> clauses;
+    for (int m : remaining) {
+        std::vector<int> covering = chart.getPIsCovering(m);
+        clauses.push_back(PetrickTerm(covering.begin(), covering.end()));
+    }
+
+    std::vector<int> literals;
+    for (size_t i = 0; i < pis.size(); i++) {
+        literals.push_back(countLiterals(std::vector<int>(1, i)));
+    }
+
+    // Variables: the PIs that appear in some clause
+    std::map<int, int> var_of_pi;
+    std::vector<int> pi_of_var;
+    long long scale = 1;
+    for (const auto& clause : clauses) {
+        for (int pi : clause) {
+            if (var_of_pi.find(pi) == var_of_pi.end()) {
+                var_of_pi[pi] = pi_of_var.size();
+                pi_of_var.push_back(pi);
+                scale += literals[pi];
+            }
+        }
+    }
+
+    // Weight = one PI (worth more than all literals together) + its literals
+    std::vector<long long> weights;
+    for (int pi : pi_of_var) {
+        weights.push_back(scale + literals[pi]);
+    }
+
+    PbOptimizer optimizer(weights);
+    for (const auto& clause : clauses) {
+        std::vector<int> lits;
+        for (int pi : clause) {
+            lits.push_back(PbOptimizer::positive(var_of_pi[pi]));
+        }
+        optimizer.addClause(lits);
+    }
+
+    // Start from the greedy cover; the optimizer only looks for cheaper ones
+    PetrickTerm seed = GreedyCoverSolver::coverClauses(clauses, literals);
+    std::vector<int> best;
+    long long best_cost = 0;
+    for (int pi : seed) {
+        best.push_back(var_of_pi[pi]);
+        best_cost += weights[var_of_pi[pi]];
+    }
+    LOG(SUMMARY) << "  ✓ Greedy seed: " << seed.size() << " PIs\n";
+
+    proven = optimizer.minimize(best_cost - 1, best, best_cost, budget);
+
+    for (int v : best) {
+        additional_pi_indices.push_back(pi_of_var[v]);
+    }
+    std::sort(additional_pi_indices.begin(), additional_pi_indices.end());
+
+    if (proven) {
+        lower_bound += additional_pi_indices.size();
+    } else {
+        lower_bound += BranchAndBoundCover(clauses, literals).computeLowerBound();
+    }
+
+    conflicts = optimizer.getConflicts();
+    decisions = optimizer.getDecisions();
+    learnt_clauses = optimizer.getLearntClauses();
+    restarts = optimizer.getRestarts();
+
+    LOG(SUMMARY) << "  ✓ Search: " << decisions << " decisions, " << conflicts << " conflicts, "
+                 << learnt_clauses << " learnt clauses, " << restarts << " restarts\n";
+}
+
+std::vector<Implicant> PbCoverSolver::getMinimalCover() const {
+    std::vector<int> all = essential_pi_indices;
+    all.insert(all.end(), additional_pi_indices.begin(), additional_pi_indices.end());
+    std::sort(all.begin(), all.end());
+
+    std::vector<Implicant> result;
+    for (int idx : all) {
+        result.push_back(chart.getPrimeImplicants()[idx]);
+    }
+    return result;
+}
+
+int PbCoverSolver::countLiterals(const std::vector<int>& pis) const {
+    int count = 0;
+    for (int idx : pis) {
+        for (char c : chart.getPrimeImplicants()[idx].value) {
+            if (c != '-') count++;
+        }
+    }
+    return count;
+}
+
+void PbCoverSolver::printSolution() const {
+    LOG(SUMMARY) << "\n╔═══════════════════════════════════════════════════════════════╗\n";
+    LOG(SUMMARY) << "║          FINAL COVER (PSEUDO-BOOLEAN SOLVER)                  ║\n";
+    LOG(SUMMARY) << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+
+    const auto& all_pis = chart.getPrimeImplicants();
+
+    if (!essential_pi_indices.empty()) {
+        LOG(SUMMARY) << "Essential PIs:\n";
+        for (int idx : essential_pi_indices) {
+            LOG(SUMMARY) << "   PI" << (idx + 1) << ": " << all_pis[idx].value << "\n";
+        }
+        LOG(SUMMARY) << "\n";
+    }
+
+    if (!additional_pi_indices.empty()) {
+        LOG(SUMMARY) << "Additional PIs (from the PB solver):\n";
+        for (int idx : additional_pi_indices) {
+            LOG(SUMMARY) << "   PI" << (idx + 1) << ": " << all_pis[idx].value << "\n";
+        }
+        LOG(SUMMARY) << "\n";
+    }
+
+    std::vector<int> all = essential_pi_indices;
+    all.insert(all.end(), additional_pi_indices.begin(), additional_pi_indices.end());
+    LOG(SUMMARY) << "Total: " << all.size() << " PIs, " << countLiterals(all) << " literals\n";
+    if (proven) {
+        LOG(SUMMARY) << "Optimality: proven optimal\n";
+    } else {
+        LOG(SUMMARY) << "Optimality: not proven (lower bound " << lower_bound << " PIs)\n";
+    }
+}
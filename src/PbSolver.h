@@ -0,0 +1,133 @@
+#pragma once
+#include "CoverSolver.h"
+#include "Petrick.h"
+#include <cstdint>
+#include <vector>
+
+// Pseudo-Boolean optimizer with conflict-driven clause learning
+// Minimizes sum(weight[v] * x[v]) subject to clauses, where x[v] = 1 means
+// "PI v is selected". Self-contained:
+//   - two watched literals per clause for unit propagation
+//   - the objective bound sum(weight * x) <= bound is propagated directly;
+//     its reasons are built lazily from the true variables on the trail
+//   - a disjoint-clause lower bound prunes branches that cannot beat the bound
+//   - first-UIP conflict analysis, learnt clauses, non-chronological backjumps
+//   - VSIDS-style activities and Luby restarts
+// Each time a solution is found, the bound is tightened below its cost and
+// the search continues; when no solution is left, the last one is optimal.
+class PbOptimizer {
+private:
+    // Literals: 2*v is x[v], 2*v+1 is NOT x[v]
+    static int neg(int lit) { return lit ^ 1; }
+    static int var(int lit) { return lit >> 1; }
+
+    static const int NO_REASON = -1;
+    static const int BOUND_REASON = -2;       // Implied by the objective bound
+
+    int num_vars;
+    std::vector<long long> weight;
+    std::vector<std::vector<int>> clauses;    // Original and learnt clauses
+    std::vector<std::vector<int>> watches;    // Clause indices watching each literal
+
+    std::vector<signed char> value;           // -1 unassigned, 0 false, 1 true
+    std::vector<int> level;
+    std::vector<int> reason;                  // Clause index, NO_REASON or BOUND_REASON
+    std::vector<int> trail_pos;
+    std::vector<int> trail;
+    std::vector<int> trail_lim;               // Trail size at each decision level
+    size_t qhead;
+
+    std::vector<int> by_weight;               // Variables by decreasing weight
+    std::vector<int> cover_clauses;           // All-positive clauses, smallest first
+    long long bound;                          // Current objective bound
+    long long true_weight;                    // Weight of the true variables
+
+    std::vector<double> activity;
+    double activity_inc;
+
+    bool unsat_at_root;                       // A clause is empty or conflicts at level 0
+
+    // Counters
+    long long conflicts;
+    long long decisions;
+    long long learnt_clauses;
+    long long restarts;
+
+    int litValue(int lit) const;              // -1 unassigned, 0 false, 1 true
+    int decisionLevel() const { return trail_lim.size(); }
+
+    void enqueue(int lit, int from);
+    int propagate();                          // Returns a conflict clause index, or -1
+    int propagateBound();                     // Bound check after a variable became 1
+    void explainBound(int lit, std::vector<int>& out) const;  // Reason of a bound implication
+    int addClauseInternal(const std::vector<int>& lits);
+    void analyze(int conflict, std::vector<int>& learnt, int& backjump_level);
+    void reasonLits(int v, std::vector<int>& out) const;
+    void backtrack(int target_level);
+    void bumpActivity(int v);
+    int pickBranchVar() const;
+
+    // Clause standing for "too expensive": NOT x for every true variable
+    int conflictFromBound();
+
+    // Pruning at a propagation fixpoint: unsatisfied covering clauses with
+    // pairwise disjoint free variables each still need their own variable.
+    // If that cost no longer fits under the bound, returns a conflict clause.
+    int lowerBoundConflict();
+
+public:
+    // weights: cost of setting each variable to 1
+    explicit PbOptimizer(const std::vector<long long>& weights);
+
+    // Add a clause; literals use the 2*v / 2*v+1 encoding
+    void addClause(const std::vector<int>& lits);
+
+    // Positive literal of variable v (for building covering clauses)
+    static int positive(int v) { return 2 * v; }
+
+    // Minimize the objective, starting below a known solution cost
+    // Updates best (assignment of selected variables) whenever a cheaper
+    // solution is found. Returns true if optimality was proven.
+    bool minimize(long long initial_bound, std::vector<int>& best, long long& best_cost,
+                  const CoverBudget& budget);
+
+    long long getConflicts() const { return conflicts; }
+    long long getDecisions() const { return decisions; }
+    long long getLearntClauses() const { return learnt_clauses; }
+    long long getRestarts() const { return restarts; }
+};
+
+// Covering engine based on PbOptimizer
+// Essential PIs are taken first; the rest of the chart becomes one clause
+// per remaining minterm, and the objective is PI count first, then literals.
+class PbCoverSolver : public CoverSolver {
+private:
+    PrimeImplicantChart chart;
+    std::vector<int> essential_pi_indices;
+    std::vector<int> additional_pi_indices;
+    CoverBudget budget;
+    bool proven;
+    int lower_bound;
+
+    // Search statistics for printSolution
+    long long conflicts;
+    long long decisions;
+    long long learnt_clauses;
+    long long restarts;
+
+    int countLiterals(const std::vector<int>& pis) const;
+
+public:
+    PbCoverSolver();
+
+    // CoverSolver interface
+    void setBudget(const CoverBudget& limits) { budget = limits; }
+    void solve(const std::vector<Implicant>& pis,
+               const std::vector<int>& minterms,
+               const std::vector<int>& dont_cares);
+    std::vector<Implicant> getMinimalCover() const;
+    void printSolution() const;
+    bool isProvenOptimal() const { return proven; }
+    int getLowerBound() const { return lower_bound; }
+    const char* getName() const { return "pb"; }
+};
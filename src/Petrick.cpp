@@ -1,4 +1,15 @@
 #include "Petrick.h"
+#include "Console.h"
+#include "MemTrack.h"
+#include "Stats.h"
+#include "BranchAndBound.h"
+#include "GreedyCover.h"
+#include "SubsumptionIndex.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <iterator>
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
@@ -9,6 +20,8 @@
 void PrimeImplicantChart::build(const std::vector<Implicant>& pis, 
                                  const std::vector<int>& minterms,
                                  const std::vector<int>& dont_cares) {
+    ScopedTimer timer("chart.build");
+    MemoryStage stage(MemTrack::CHART);
     prime_implicants = pis;
     
     // Step 1: Filter out only on-set minterms (exclude don't cares)
@@ -44,9 +57,15 @@ void PrimeImplicantChart::build(const std::vector<Implicant>& pis,
             }
         }
     }
+    
+    if (RunStats* stats = activeStats()) {
+        stats->add("chart.pis", pis.size());
+        stats->add("chart.minterms", on_set_minterms.size());
+    }
 }
 
 std::vector<EssentialPIInfo> PrimeImplicantChart::findEssentialPIs() const {
+    ScopedTimer timer("chart.essentials");
     std::vector<EssentialPIInfo> essential_pis;
     
     // For each minterm (column), count how many PIs cover it
@@ -84,6 +103,10 @@ std::vector<EssentialPIInfo> PrimeImplicantChart::findEssentialPIs() const {
         }
     }
     
+    if (RunStats* stats = activeStats()) {
+        stats->add("chart.essential_pis", essential_pis.size());
+    }
+    
     return essential_pis;
 }
 
@@ -138,37 +161,39 @@ std::vector<int> PrimeImplicantChart::getPIsCovering(int minterm) const {
 }
 
 void PrimeImplicantChart::print() const {
-    std::cout << "\n╔═══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║          Prime Implicant Coverage Chart                      ║\n";
-    std::cout << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+    if (!logEnabled(LogLevel::DETAILED)) return;
+    
+    console() << "\n╔═══════════════════════════════════════════════════════════════╗\n";
+    console() << "║          Prime Implicant Coverage Chart                      ║\n";
+    console() << "╚═══════════════════════════════════════════════════════════════╝\n\n";
     
     // Print header (minterms)
-    std::cout << "        ";
+    console() << "        ";
     for (int m : on_set_minterms) {
-        std::cout << " m" << std::setw(2) << m;
+        console() << " m" << std::setw(2) << m;
     }
-    std::cout << "\n        ";
+    console() << "\n        ";
     for (size_t i = 0; i < on_set_minterms.size(); i++) {
-        std::cout << "----";
+        console() << "----";
     }
-    std::cout << "\n";
+    console() << "\n";
     
     // Print each PI row
     for (size_t i = 0; i < prime_implicants.size(); i++) {
-        std::cout << "PI" << std::setw(2) << (i+1) << " " 
+        console() << "PI" << std::setw(2) << (i+1) << " " 
                   << prime_implicants[i].value << " |";
         
         for (size_t j = 0; j < on_set_minterms.size(); j++) {
             if (coverage[i][j]) {
-                std::cout << "  ✓ ";
+                console() << "  ✓ ";
             } else {
-                std::cout << "  · ";
+                console() << "  · ";
             }
         }
         
-        std::cout << " | m" << prime_implicants[i].mintermsToString() << "\n";
+        console() << " | m" << prime_implicants[i].mintermsToString() << "\n";
     }
-    std::cout << "\n";
+    console() << "\n";
 }
 
 // ==================== PetrickSolver Implementation ====================
@@ -178,38 +203,46 @@ void PetrickSolver::solve(const std::vector<Implicant>& pis,
                           const std::vector<int>& dont_cares) {
     essential_pi_indices.clear();
     additional_pi_indices.clear();
+    components.clear();
     
     // Step 1: Build coverage chart
-    std::cout << "\n[Step 4] Petrick's Algorithm\n";
+    LOG(SUMMARY) << "\n[Step 4] Petrick's Algorithm\n";
     chart.build(pis, minterms, dont_cares);
     chart.print();
     
+    pi_literals.clear();
+    for (size_t i = 0; i < pis.size(); i++) {
+        PetrickTerm single;
+        single.insert(i);
+        pi_literals.push_back(countLiterals(single));
+    }
+    
     // Step 2: Find Essential Prime Implicants
-    std::cout << "╔═══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║          Finding Essential Prime Implicants                   ║\n";
-    std::cout << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+    LOG(DETAILED) << "╔═══════════════════════════════════════════════════════════════╗\n";
+    LOG(DETAILED) << "║          Finding Essential Prime Implicants                   ║\n";
+    LOG(DETAILED) << "╚═══════════════════════════════════════════════════════════════╝\n\n";
     
     auto essential_infos = chart.findEssentialPIs();
     
     if (essential_infos.empty()) {
-        std::cout << "❌ No Essential Prime Implicants found.\n";
-        std::cout << "   Every minterm is covered by multiple PIs.\n\n";
+        LOG(SUMMARY) << "❌ No Essential Prime Implicants found.\n";
+        LOG(SUMMARY) << "   Every minterm is covered by multiple PIs.\n\n";
     } else {
-        std::cout << "✅ Found " << essential_infos.size() << " Essential Prime Implicant(s):\n\n";
+        LOG(SUMMARY) << "✅ Found " << essential_infos.size() << " Essential Prime Implicant(s):\n\n";
         
         for (const auto& epi : essential_infos) {
             essential_pi_indices.push_back(epi.pi_index);
             const Implicant& pi = chart.getPrimeImplicants()[epi.pi_index];
             
-            std::cout << "   PI" << (epi.pi_index + 1) << ": " << pi.value << " is ESSENTIAL\n";
-            std::cout << "      Reason: Only PI covering ";
+            LOG(DETAILED) << "   PI" << (epi.pi_index + 1) << ": " << pi.value << " is ESSENTIAL\n";
+            LOG(DETAILED) << "      Reason: Only PI covering ";
             
             for (size_t i = 0; i < epi.unique_minterms.size(); i++) {
-                std::cout << "m" << epi.unique_minterms[i];
-                if (i < epi.unique_minterms.size() - 1) std::cout << ", ";
+                LOG(DETAILED) << "m" << epi.unique_minterms[i];
+                if (i < epi.unique_minterms.size() - 1) LOG(DETAILED) << ", ";
             }
-            std::cout << "\n";
-            std::cout << "      Total coverage: m" << pi.mintermsToString() << "\n\n";
+            LOG(DETAILED) << "\n";
+            LOG(DETAILED) << "      Total coverage: m" << pi.mintermsToString() << "\n\n";
         }
     }
     
@@ -217,64 +250,179 @@ void PetrickSolver::solve(const std::vector<Implicant>& pis,
     std::vector<int> remaining = chart.getRemainingMinterms(essential_pi_indices);
     
     if (remaining.empty()) {
-        std::cout << "🎉 All minterms covered by Essential PIs!\n";
-        std::cout << "   No need for Petrick's Method.\n";
+        LOG(SUMMARY) << "🎉 All minterms covered by Essential PIs!\n";
+        LOG(SUMMARY) << "   No need for Petrick's Method.\n";
         return;
     }
     
     // Step 4: Apply Petrick's Method
-    std::cout << "╔═══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║          Applying Petrick's Method                            ║\n";
-    std::cout << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+    LOG(DETAILED) << "╔═══════════════════════════════════════════════════════════════╗\n";
+    LOG(DETAILED) << "║          Applying Petrick's Method                            ║\n";
+    LOG(DETAILED) << "╚═══════════════════════════════════════════════════════════════╝\n\n";
     
-    std::cout << "Remaining uncovered minterms: ";
+    LOG(DETAILED) << "Remaining uncovered minterms: ";
     for (size_t i = 0; i < remaining.size(); i++) {
-        std::cout << "m" << remaining[i];
-        if (i < remaining.size() - 1) std::cout << ", ";
+        LOG(DETAILED) << "m" << remaining[i];
+        if (i < remaining.size() - 1) LOG(DETAILED) << ", ";
     }
-    std::cout << "\n\n";
+    LOG(DETAILED) << "\n\n";
     
-    // Build and solve Petrick's function
-    PetrickSOP petrick = buildPetrickFunction(remaining);
-    printDetailedSteps(remaining, petrick);
+    // Split the remaining chart into independent components
+    components = findComponents(remaining);
     
-    // Simplify
-    simplify(petrick);
+    if (components.size() > 1) {
+        LOG(SUMMARY) << "Chart splits into " << components.size() 
+                     << " independent component(s), solved separately\n\n";
+    }
+    
+    // Build and expand Petrick's function of every component
+    int threads = num_threads > 0 ? num_threads : ThreadPool::defaultThreadCount();
+    
+    if (threads > 1 && components.size() > 1) {
+        // Components share no PI, so they can be expanded concurrently
+        ThreadPool pool(std::min<int>(threads, components.size()));
+        std::vector<std::future<void>> pending;
+        RunStats* stats = activeStats();
+        for (auto& component : components) {
+            PetrickComponent* target = &component;
+            pending.push_back(pool.submit([this, target, stats]() {
+                ScopedStats collect(stats);
+                solveComponent(*target);
+            }));
+        }
+        for (auto& f : pending) {
+            f.get();
+        }
+    } else if (threads > 1) {
+        // A single component: parallelize each multiplication instead
+        ThreadPool pool(threads);
+        solveComponent(components[0], &pool);
+    } else {
+        for (auto& component : components) {
+            solveComponent(component);
+        }
+    }
     
-    // Select minimal cover
-    PetrickTerm minimal = selectMinimalCover(petrick);
-    additional_pi_indices = std::vector<int>(minimal.begin(), minimal.end());
+    // Report each component and select its minimal cover
+    for (size_t c = 0; c < components.size(); c++) {
+        PetrickComponent& component = components[c];
+        
+        if (components.size() > 1) {
+            LOG(DETAILED) << "── Component " << (c + 1) << ": ";
+            for (size_t i = 0; i < component.minterms.size(); i++) {
+                LOG(DETAILED) << "m" << component.minterms[i];
+                if (i < component.minterms.size() - 1) LOG(DETAILED) << ", ";
+            }
+            LOG(DETAILED) << "\n\n";
+        }
+        
+        printPetrickFunction(component);
+        
+        if (component.aborted) {
+            // Budget ran out: the cover came from branch-and-bound
+            LOG(SUMMARY) << "⏱  Budget reached after " << component.sop_sizes.size() << " of "
+                         << component.clauses.size() << " clause(s); switched to branch-and-bound ("
+                         << component.search_nodes << " nodes)\n";
+            LOG(DETAILED) << "   Best cover: ";
+            bool first = true;
+            for (int pi : component.cover) {
+                if (!first) LOG(DETAILED) << " + ";
+                LOG(DETAILED) << "PI" << (pi + 1);
+                first = false;
+            }
+            LOG(DETAILED) << "  (" << component.cover.size() << " PIs, "
+                          << countLiterals(component.cover) << " literals)\n";
+            if (component.proven) {
+                LOG(DETAILED) << "   Proven optimal\n\n";
+            } else {
+                LOG(DETAILED) << "   Lower bound: " << component.lower_bound << " PIs (gap "
+                              << (component.cover.size() - component.lower_bound) << ")\n\n";
+            }
+        } else {
+            printDetailedSteps(component.minterms, component.solutions);
+            
+            // Select minimal cover
+            component.cover = selectMinimalCover(component.solutions);
+            component.lower_bound = component.cover.size();
+        }
+        
+        additional_pi_indices.insert(additional_pi_indices.end(),
+                                     component.cover.begin(), component.cover.end());
+    }
+    
+    std::sort(additional_pi_indices.begin(), additional_pi_indices.end());
 }
 
-PetrickSOP PetrickSolver::buildPetrickFunction(const std::vector<int>& remaining_minterms) {
-    PetrickSOP result;
+std::vector<PetrickComponent> PetrickSolver::findComponents(
+    const std::vector<int>& remaining_minterms) const {
+    
+    // Union-find over the remaining minterms; two minterms are joined
+    // whenever some PI covers both of them
+    std::vector<int> parent(remaining_minterms.size());
+    for (size_t i = 0; i < parent.size(); i++) {
+        parent[i] = i;
+    }
     
-    std::cout << "Building Petrick's function P:\n\n";
-    std::cout << "P = ";
+    std::function<int(int)> find = [&parent, &find](int x) {
+        if (parent[x] != x) {
+            parent[x] = find(parent[x]);
+        }
+        return parent[x];
+    };
     
-    bool first_minterm = true;
+    std::map<int, int> first_minterm_of_pi;  // PI index -> first remaining minterm it covers
     
-    for (int minterm : remaining_minterms) {
-        // Get all PIs covering this minterm
-        std::vector<int> covering_pis = chart.getPIsCovering(minterm);
-        
-        // Print clause
-        if (!first_minterm) {
-            std::cout << " · ";
-        }
-        std::cout << "(";
-        for (size_t i = 0; i < covering_pis.size(); i++) {
-            std::cout << "PI" << (covering_pis[i] + 1);
-            if (i < covering_pis.size() - 1) std::cout << "+";
+    for (size_t j = 0; j < remaining_minterms.size(); j++) {
+        for (int pi : chart.getPIsCovering(remaining_minterms[j])) {
+            auto it = first_minterm_of_pi.find(pi);
+            if (it == first_minterm_of_pi.end()) {
+                first_minterm_of_pi[pi] = j;
+            } else {
+                int a = find(it->second);
+                int b = find(j);
+                if (a != b) {
+                    parent[std::max(a, b)] = std::min(a, b);
+                }
+            }
         }
-        std::cout << ")";
-        
-        // Convert to PetrickTerm (clause)
-        PetrickTerm clause;
-        for (int pi : covering_pis) {
-            clause.insert(pi);
+    }
+    
+    // Group minterms by root; roots are visited in minterm order
+    std::vector<PetrickComponent> result;
+    std::map<int, int> component_of_root;
+    
+    for (size_t j = 0; j < remaining_minterms.size(); j++) {
+        int root = find(j);
+        auto it = component_of_root.find(root);
+        if (it == component_of_root.end()) {
+            component_of_root[root] = result.size();
+            result.push_back(PetrickComponent());
+            result.back().minterms.push_back(remaining_minterms[j]);
+        } else {
+            result[it->second].minterms.push_back(remaining_minterms[j]);
         }
-        
+    }
+    
+    return result;
+}
+
+void PetrickSolver::buildPetrickFunction(PetrickComponent& component, ThreadPool* pool) const {
+    PetrickSOP result;
+    component.sop_sizes.clear();
+    
+    // Collect one clause (sum of covering PIs) per remaining minterm
+    component.original_clauses.clear();
+    for (int minterm : component.minterms) {
+        // Get all PIs covering this minterm
+        std::vector<int> covering_pis = chart.getPIsCovering(minterm);
+        component.original_clauses.push_back(PetrickTerm(covering_pis.begin(), covering_pis.end()));
+    }
+    
+    // Drop redundant clauses and choose a multiplication order
+    component.clauses = component.original_clauses;
+    preprocessClauses(component.clauses);
+    
+    for (const auto& clause : component.clauses) {
         // Multiply into result
         if (result.empty()) {
             // First clause: initialize
@@ -284,76 +432,366 @@ PetrickSOP PetrickSolver::buildPetrickFunction(const std::vector<int>& remaining
                 result.push_back(term);
             }
         } else {
-            // Subsequent clauses: multiply
-            result = multiply(result, clause);
+            // Stop before a product that could not fit in the memory budget
+            if (budget.exceedsMemory(approxSopBytes(result) * clause.size())) {
+                component.aborted = true;
+                break;
+            }
+            
+            // Subsequent clauses: multiply (empty if the time ran out)
+            result = multiply(result, clause, pool);
+            if (result.empty()) {
+                component.aborted = true;
+                break;
+            }
         }
         
-        first_minterm = false;
+        component.sop_sizes.push_back(result.size());
+        
+        if (budget.timeExpired()) {
+            component.aborted = true;
+            break;
+        }
+    }
+    
+    if (component.aborted) {
+        component.solutions.clear();
+        return;
     }
     
-    std::cout << "\n\n";
+    // Simplify
+    simplify(result);
+    component.solutions.swap(result);
+}
+
+void PetrickSolver::solveComponent(PetrickComponent& component, ThreadPool* pool) const {
+    MemoryStage stage(MemTrack::PETRICK);
+    buildPetrickFunction(component, pool);
     
-    return result;
+    if (!component.aborted) {
+        return;
+    }
+    
+    // Anytime search: start from a greedy cover and improve it until the
+    // search space is exhausted or the time budget runs out
+    BranchAndBoundCover search(component.clauses, pi_literals);
+    search.setIncumbent(GreedyCoverSolver::coverClauses(component.clauses, pi_literals));
+    component.proven = search.search(budget);
+    component.cover = search.getBestCover();
+    component.lower_bound = search.getLowerBound();
+    component.search_nodes = search.getNodesExplored();
 }
 
-PetrickSOP PetrickSolver::multiply(const PetrickSOP& sop, const PetrickTerm& clause) {
-    PetrickSOP result;
+// Rough heap footprint of an SOP: one std::set header per term plus one
+// tree node per PI
+size_t PetrickSolver::approxSopBytes(const PetrickSOP& sop) {
+    size_t bytes = sop.capacity() * sizeof(PetrickTerm);
+    for (const auto& term : sop) {
+        bytes += term.size() * 40;
+    }
+    return bytes;
+}
+
+void PetrickSolver::printPetrickFunction(const PetrickComponent& component) const {
+    if (!logEnabled(LogLevel::DETAILED)) return;
+    
+    console() << "Building Petrick's function P:\n\n";
+    console() << "P = ";
+    printClauses(component.original_clauses);
+    
+    console() << "Clause preprocessing: kept " << component.clauses.size() << " of " 
+              << component.original_clauses.size() << " clause(s)\n";
+    console() << "P = ";
+    printClauses(component.clauses);
+    
+    // Report how large the SOP grew after each clause
+    console() << "Intermediate SOP sizes: ";
+    size_t peak = 0;
+    for (size_t i = 0; i < component.sop_sizes.size(); i++) {
+        console() << component.sop_sizes[i];
+        if (i < component.sop_sizes.size() - 1) console() << " -> ";
+        peak = std::max(peak, component.sop_sizes[i]);
+    }
+    console() << "  (peak " << peak << ")\n\n";
+}
+
+void PetrickSolver::preprocessClauses(std::vector<PetrickTerm>& clauses) const {
+    // Step 1: Remove duplicate clauses
+    std::vector<PetrickTerm> unique_clauses = clauses;
+    std::sort(unique_clauses.begin(), unique_clauses.end());
+    unique_clauses.erase(std::unique(unique_clauses.begin(), unique_clauses.end()),
+                         unique_clauses.end());
+    
+    // Step 2: Drop clauses that are supersets of another clause
+    // If C1 is a subset of C2, any product satisfying C1 also satisfies C2
+    SubsumptionIndex index;
+    for (const auto& clause : unique_clauses) {
+        index.insert(clause);
+    }
     
-    // For each existing product term
-    for (const auto& existing_term : sop) {
-        // Multiply with each PI in the clause
-        for (int pi : clause) {
-            PetrickTerm new_term = existing_term;
-            new_term.insert(pi);  // Set automatically handles duplicates
+    std::vector<PetrickTerm> pending;
+    for (const auto& clause : unique_clauses) {
+        if (!index.containsSubsetOf(clause, true)) {
+            pending.push_back(clause);
+        }
+    }
+    
+    // Step 3: Order smallest-first; among clauses of equal size, prefer the one
+    // sharing the most PIs with clauses already multiplied, since its
+    // expansions are more likely to be absorbed
+    std::vector<PetrickTerm> ordered;
+    std::set<int> seen_pis;
+    std::vector<bool> taken(pending.size(), false);
+    
+    for (size_t step = 0; step < pending.size(); step++) {
+        int best = -1;
+        int best_overlap = -1;
+        
+        for (size_t i = 0; i < pending.size(); i++) {
+            if (taken[i]) continue;
             
-            // Check if already exists
-            bool exists = false;
-            for (const auto& r : result) {
-                if (r == new_term) {
-                    exists = true;
-                    break;
-                }
+            int overlap = 0;
+            for (int pi : pending[i]) {
+                if (seen_pis.count(pi)) overlap++;
             }
             
-            if (!exists) {
-                result.push_back(new_term);
+            if (best < 0 || pending[i].size() < pending[best].size() ||
+                (pending[i].size() == pending[best].size() && overlap > best_overlap)) {
+                best = i;
+                best_overlap = overlap;
+            }
+        }
+        
+        taken[best] = true;
+        seen_pis.insert(pending[best].begin(), pending[best].end());
+        ordered.push_back(pending[best]);
+    }
+    
+    clauses.swap(ordered);
+}
+
+void PetrickSolver::printClauses(const std::vector<PetrickTerm>& clauses) const {
+    if (!logEnabled(LogLevel::DETAILED)) return;
+    
+    for (size_t c = 0; c < clauses.size(); c++) {
+        if (c > 0) {
+            console() << " · ";
+        }
+        console() << "(";
+        bool first = true;
+        for (int pi : clauses[c]) {
+            if (!first) console() << "+";
+            console() << "PI" << (pi + 1);
+            first = false;
+        }
+        console() << ")";
+    }
+    console() << "\n\n";
+}
+
+// Hash of a PetrickTerm, used to shard terms between threads
+struct PetrickTermHash {
+    size_t operator()(const PetrickTerm& term) const {
+        size_t h = 14695981039346656037ULL;  // FNV-1a
+        for (int pi : term) {
+            h ^= (size_t)pi;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+};
+
+// Multiply one existing term with a clause, appending the products to out
+static void expandTerm(const PetrickTerm& existing_term, const PetrickTerm& clause,
+                       std::vector<PetrickTerm>& out) {
+    // If the term already contains a PI of the clause, X·(a + ...) = X
+    // absorbs every other expansion of this term
+    for (int pi : clause) {
+        if (existing_term.count(pi)) {
+            out.push_back(existing_term);
+            return;
+        }
+    }
+    
+    // Multiply with each PI in the clause
+    for (int pi : clause) {
+        PetrickTerm new_term = existing_term;
+        new_term.insert(pi);
+        out.push_back(new_term);
+    }
+}
+
+PetrickSOP PetrickSolver::multiply(const PetrickSOP& sop, const PetrickTerm& clause,
+                                   ThreadPool* pool) const {
+    ScopedTimer timer("petrick.multiply");
+    RunStats* stats = activeStats();
+    if (stats) {
+        stats->setMax("petrick.peak_products", sop.size() * clause.size());
+    }
+    
+    // Small products are not worth the thread hand-off
+    if (pool != nullptr && pool->size() > 1 &&
+        sop.size() * clause.size() >= PARALLEL_MULTIPLY_THRESHOLD) {
+        PetrickSOP result = multiplyParallel(sop, clause, *pool);
+        if (stats) stats->setMax("petrick.peak_sop_terms", result.size());
+        return result;
+    }
+    
+    PetrickSOP result;
+    result.reserve(sop.size() * clause.size());
+    
+    // For each existing product term; one product can take longer than
+    // the whole time budget, so the clock is read every TIME_CHECK_TERMS
+    for (size_t i = 0; i < sop.size(); i++) {
+        if (i % TIME_CHECK_TERMS == 0 && budget.timeExpired()) {
+            return PetrickSOP();
+        }
+        expandTerm(sop[i], clause, result);
+    }
+    
+    // Incremental absorption: keep the SOP minimal after every clause
+    simplify(result);
+    if (stats) stats->setMax("petrick.peak_sop_terms", result.size());
+    
+    return result;
+}
+
+PetrickSOP PetrickSolver::multiplyParallel(const PetrickSOP& sop, const PetrickTerm& clause,
+                                           ThreadPool& pool) const {
+    const size_t num_parts = pool.size();
+    const size_t num_shards = pool.size();
+    PetrickTermHash hasher;
+    
+    // Phase 1: each thread expands a slice of the SOP and drops every
+    // product into the shard chosen by its hash
+    // buckets[part][shard] is written only by the thread of that part
+    std::vector<std::vector<std::vector<PetrickTerm>>> buckets(
+        num_parts, std::vector<std::vector<PetrickTerm>>(num_shards));
+    std::vector<std::future<void>> pending;
+    std::atomic<bool> expired(false);
+    
+    for (size_t part = 0; part < num_parts; part++) {
+        size_t begin = sop.size() * part / num_parts;
+        size_t end = sop.size() * (part + 1) / num_parts;
+        std::vector<std::vector<PetrickTerm>>* out = &buckets[part];
+        
+        pending.push_back(pool.submit([this, &sop, &clause, &hasher, &expired, out, begin, end,
+                                       num_shards]() {
+            MemoryStage stage(MemTrack::PETRICK);
+            std::vector<PetrickTerm> products;
+            for (size_t i = begin; i < end; i++) {
+                if ((i - begin) % TIME_CHECK_TERMS == 0 && (expired || budget.timeExpired())) {
+                    expired = true;
+                    return;
+                }
+                products.clear();
+                expandTerm(sop[i], clause, products);
+                for (auto& term : products) {
+                    (*out)[hasher(term) % num_shards].push_back(std::move(term));
+                }
+            }
+        }));
+    }
+    for (auto& f : pending) {
+        f.get();
+    }
+    pending.clear();
+    if (expired) return PetrickSOP();
+    
+    // Phase 2: each shard removes its duplicates; equal terms always hash
+    // to the same shard, so shards never need to talk to each other
+    std::vector<std::vector<PetrickTerm>> shards(num_shards);
+    
+    for (size_t shard = 0; shard < num_shards; shard++) {
+        pending.push_back(pool.submit([&buckets, &shards, shard, num_parts]() {
+            MemoryStage stage(MemTrack::PETRICK);
+            std::vector<PetrickTerm>& merged = shards[shard];
+            for (size_t part = 0; part < num_parts; part++) {
+                std::vector<PetrickTerm>& bucket = buckets[part][shard];
+                std::move(bucket.begin(), bucket.end(), std::back_inserter(merged));
+                std::vector<PetrickTerm>().swap(bucket);
             }
+            std::sort(merged.begin(), merged.end());
+            merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+        }));
+    }
+    for (auto& f : pending) {
+        f.get();
+    }
+    pending.clear();
+    
+    // Phase 3: absorption. The index is filled once and then only read,
+    // so every shard can look up its terms concurrently. All terms are
+    // distinct now, so a proper subset is exactly an absorbing term.
+    SubsumptionIndex index;
+    for (const auto& shard : shards) {
+        for (const auto& term : shard) {
+            index.insert(term);
         }
     }
     
+    std::vector<PetrickSOP> survivors(num_shards);
+    for (size_t shard = 0; shard < num_shards; shard++) {
+        pending.push_back(pool.submit([&index, &shards, &survivors, shard]() {
+            MemoryStage stage(MemTrack::PETRICK);
+            for (auto& term : shards[shard]) {
+                if (!index.containsSubsetOf(term, true)) {
+                    survivors[shard].push_back(std::move(term));
+                }
+            }
+        }));
+    }
+    for (auto& f : pending) {
+        f.get();
+    }
+    
+    // Same order as the serial simplify(): sorted terms
+    PetrickSOP result;
+    for (auto& part : survivors) {
+        std::move(part.begin(), part.end(), std::back_inserter(result));
+    }
+    std::sort(result.begin(), result.end());
+    
     return result;
 }
 
-void PetrickSolver::simplify(PetrickSOP& sop) {
+void PetrickSolver::simplify(PetrickSOP& sop) const {
+    ScopedTimer timer("petrick.simplify");
+    
     // Remove duplicate terms
     std::sort(sop.begin(), sop.end());
     sop.erase(std::unique(sop.begin(), sop.end()), sop.end());
     
     // Apply absorption law: A + AB = A
-    // Remove terms that are supersets of other terms
-    PetrickSOP simplified;
-    
+    // Visit terms smallest-first, so any term that absorbs sop[i] has
+    // already been kept and stored in the index by the time sop[i] is checked
+    std::vector<size_t> order(sop.size());
     for (size_t i = 0; i < sop.size(); i++) {
-        bool is_absorbed = false;
-        
-        for (size_t j = 0; j < sop.size(); j++) {
-            if (i != j) {
-                // If sop[j] is a subset of sop[i], then sop[i] is absorbed
-                if (std::includes(sop[i].begin(), sop[i].end(),
-                                 sop[j].begin(), sop[j].end()) && 
-                    sop[j].size() < sop[i].size()) {
-                    is_absorbed = true;
-                    break;
-                }
-            }
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sop](size_t a, size_t b) {
+        return sop[a].size() < sop[b].size();
+    });
+    
+    SubsumptionIndex index;
+    std::vector<bool> keep(sop.size(), false);
+    
+    for (size_t idx : order) {
+        if (!index.containsSubsetOf(sop[idx])) {
+            keep[idx] = true;
+            index.insert(sop[idx]);
         }
-        
-        if (!is_absorbed) {
+    }
+    
+    // Keep the surviving terms in sorted order
+    PetrickSOP simplified;
+    for (size_t i = 0; i < sop.size(); i++) {
+        if (keep[i]) {
             simplified.push_back(sop[i]);
         }
     }
     
-    sop = simplified;
+    sop.swap(simplified);
 }
 
 PetrickTerm PetrickSolver::selectMinimalCover(const PetrickSOP& solutions) {
@@ -377,19 +815,19 @@ PetrickTerm PetrickSolver::selectMinimalCover(const PetrickSOP& solutions) {
         }
     }
     
-    std::cout << "Simplified solutions:\n";
+    LOG(DETAILED) << "Simplified solutions:\n";
     for (size_t i = 0; i < candidates.size(); i++) {
-        std::cout << "   Solution " << (i+1) << ": ";
+        LOG(DETAILED) << "   Solution " << (i+1) << ": ";
         bool first = true;
         for (int pi : candidates[i]) {
-            if (!first) std::cout << " + ";
-            std::cout << "PI" << (pi + 1);
+            if (!first) LOG(DETAILED) << " + ";
+            LOG(DETAILED) << "PI" << (pi + 1);
             first = false;
         }
-        std::cout << "  (" << candidates[i].size() << " PIs, " 
-                  << countLiterals(candidates[i]) << " literals)\n";
+        LOG(DETAILED) << "  (" << candidates[i].size() << " PIs, " 
+                      << countLiterals(candidates[i]) << " literals)\n";
     }
-    std::cout << "\n";
+    LOG(DETAILED) << "\n";
     
     // If multiple candidates, choose one with fewest literals
     if (candidates.size() > 1) {
@@ -404,14 +842,14 @@ PetrickTerm PetrickSolver::selectMinimalCover(const PetrickSOP& solutions) {
             }
         }
         
-        std::cout << "Selected solution with fewest literals: ";
+        LOG(DETAILED) << "Selected solution with fewest literals: ";
         bool first = true;
         for (int pi : best) {
-            if (!first) std::cout << " + ";
-            std::cout << "PI" << (pi + 1);
+            if (!first) LOG(DETAILED) << " + ";
+            LOG(DETAILED) << "PI" << (pi + 1);
             first = false;
         }
-        std::cout << "\n\n";
+        LOG(DETAILED) << "\n\n";
         
         return best;
     }
@@ -442,6 +880,23 @@ std::vector<int> PetrickSolver::getAllSelectedPIs() const {
     return all;
 }
 
+bool PetrickSolver::isProvenOptimal() const {
+    for (const auto& component : components) {
+        if (!component.proven) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int PetrickSolver::getLowerBound() const {
+    int bound = essential_pi_indices.size();
+    for (const auto& component : components) {
+        bound += component.lower_bound;
+    }
+    return bound;
+}
+
 std::vector<Implicant> PetrickSolver::getMinimalCover() const {
     std::vector<Implicant> result;
     auto all_indices = getAllSelectedPIs();
@@ -456,56 +911,67 @@ std::vector<Implicant> PetrickSolver::getMinimalCover() const {
 
 void PetrickSolver::printDetailedSteps(const std::vector<int>& remaining_minterms,
                                        const PetrickSOP& petrick_function) {
-    std::cout << "Expanding Petrick's function:\n";
-    std::cout << "After multiplication, we get " << petrick_function.size() << " product term(s):\n\n";
+    if (!logEnabled(LogLevel::DETAILED)) return;
+    
+    console() << "Expanding Petrick's function:\n";
+    console() << "After multiplication, we get " << petrick_function.size() << " product term(s):\n\n";
     
     for (size_t i = 0; i < std::min(petrick_function.size(), size_t(10)); i++) {
-        std::cout << "   ";
+        console() << "   ";
         bool first = true;
         for (int pi : petrick_function[i]) {
-            if (!first) std::cout << "·";
-            std::cout << "PI" << (pi + 1);
+            if (!first) console() << "·";
+            console() << "PI" << (pi + 1);
             first = false;
         }
-        std::cout << "\n";
+        console() << "\n";
     }
     
     if (petrick_function.size() > 10) {
-        std::cout << "   ... (" << (petrick_function.size() - 10) << " more)\n";
+        console() << "   ... (" << (petrick_function.size() - 10) << " more)\n";
     }
-    std::cout << "\n";
+    console() << "\n";
 }
 
 void PetrickSolver::printSolution() const {
-    std::cout << "\n╔═══════════════════════════════════════════════════════════════╗\n";
-    std::cout << "║          FINAL MINIMAL COVER                                  ║\n";
-    std::cout << "╚═══════════════════════════════════════════════════════════════╝\n\n";
+    LOG(SUMMARY) << "\n╔═══════════════════════════════════════════════════════════════╗\n";
+    LOG(SUMMARY) << "║          FINAL MINIMAL COVER                                  ║\n";
+    LOG(SUMMARY) << "╚═══════════════════════════════════════════════════════════════╝\n\n";
     
     auto all_indices = getAllSelectedPIs();
     const auto& all_pis = chart.getPrimeImplicants();
     
-    std::cout << "Selected Prime Implicants (" << all_indices.size() << " total):\n\n";
+    LOG(SUMMARY) << "Selected Prime Implicants (" << all_indices.size() << " total):\n\n";
     
     if (!essential_pi_indices.empty()) {
-        std::cout << "Essential PIs:\n";
+        LOG(SUMMARY) << "Essential PIs:\n";
         for (int idx : essential_pi_indices) {
-            std::cout << "   PI" << (idx + 1) << ": " << all_pis[idx].value 
-                     << "  (m" << all_pis[idx].mintermsToString() << ")\n";
+            LOG(SUMMARY) << "   PI" << (idx + 1) << ": " << all_pis[idx].value 
+                        << "  (m" << all_pis[idx].mintermsToString() << ")\n";
         }
-        std::cout << "\n";
+        LOG(SUMMARY) << "\n";
     }
     
     if (!additional_pi_indices.empty()) {
-        std::cout << "Additional PIs (from Petrick's Method):\n";
+        LOG(SUMMARY) << "Additional PIs (from Petrick's Method):\n";
         for (int idx : additional_pi_indices) {
-            std::cout << "   PI" << (idx + 1) << ": " << all_pis[idx].value 
-                     << "  (m" << all_pis[idx].mintermsToString() << ")\n";
+            LOG(SUMMARY) << "   PI" << (idx + 1) << ": " << all_pis[idx].value 
+                        << "  (m" << all_pis[idx].mintermsToString() << ")\n";
         }
-        std::cout << "\n";
+        LOG(SUMMARY) << "\n";
     }
     
     // Calculate total literals
     int total_literals = countLiterals(PetrickTerm(all_indices.begin(), all_indices.end()));
-    std::cout << "Total: " << all_indices.size() << " PIs, " 
-              << total_literals << " literals\n";
+    LOG(SUMMARY) << "Total: " << all_indices.size() << " PIs, " 
+                 << total_literals << " literals\n";
+    
+    if (budget.isLimited()) {
+        if (isProvenOptimal()) {
+            LOG(SUMMARY) << "Optimality: proven optimal\n";
+        } else {
+            LOG(SUMMARY) << "Optimality: not proven (lower bound " << getLowerBound() 
+                         << " PIs, gap " << (all_indices.size() - getLowerBound()) << ")\n";
+        }
+    }
 }
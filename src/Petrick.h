@@ -1,9 +1,13 @@
 #pragma once
 #include "QuineMcCluskey.h"
+#include "CoverBudget.h"
+#include "CoverSolver.h"
 #include <vector>
 #include <set>
 #include <map>
 
+class ThreadPool;
+
 // Type definitions for Petrick's Method
 // A PetrickTerm is a set of PI indices (represents AND operation)
 // Example: {0, 2, 3} means PI0 AND PI2 AND PI3
@@ -19,6 +23,22 @@ struct EssentialPIInfo {
     std::vector<int> unique_minterms;  // Minterms covered ONLY by this PI
 };
 
+// One independent part of the covering problem left after Essential PIs
+// No PI covers minterms of two different components, so each component
+// can be solved on its own and the sub-covers concatenated
+struct PetrickComponent {
+    std::vector<int> minterms;                  // Remaining minterms in this component
+    std::vector<PetrickTerm> original_clauses;  // One clause per minterm, in minterm order
+    std::vector<PetrickTerm> clauses;           // Clauses after preprocessing, in multiplication order
+    std::vector<size_t> sop_sizes;              // SOP size after each clause multiplication
+    PetrickSOP solutions;                       // Simplified expansion of Petrick's function
+    PetrickTerm cover;                          // Selected minimal cover
+    bool aborted = false;                       // Expansion stopped by the budget
+    bool proven = true;                         // Is cover proven minimal?
+    int lower_bound = 0;                        // Lower bound on the number of PIs needed
+    long long search_nodes = 0;                 // Branch-and-bound nodes after an abort
+};
+
 // Prime Implicant Coverage Chart
 // Shows which PIs cover which minterms
 class PrimeImplicantChart {
@@ -60,20 +80,61 @@ public:
 
 // Petrick's Method Solver
 // Finds the minimal set of PIs to cover all on-set minterms
-class PetrickSolver {
+class PetrickSolver : public CoverSolver {
+    friend class KernelBench;                   // tools/kernel_bench times the private kernels
+
 private:
     PrimeImplicantChart chart;
     std::vector<int> essential_pi_indices;      // Indices of Essential PIs
     std::vector<int> additional_pi_indices;     // Additional PIs selected by Petrick's Method
+    std::vector<PetrickComponent> components;   // Independent parts of the remaining chart
+    int num_threads;                            // Worker threads for components (0 = hardware)
+    CoverBudget budget;                         // Time/memory budget of the covering stage
+    std::vector<int> pi_literals;               // Literal count of every PI
+    
+    // Split remaining minterms into components that share no covering PI
+    std::vector<PetrickComponent> findComponents(const std::vector<int>& remaining_minterms) const;
     
-    // Build Petrick's function for remaining minterms
-    PetrickSOP buildPetrickFunction(const std::vector<int>& remaining_minterms);
+    // Build and expand Petrick's function of one component (no console output)
+    // With a pool, large multiplications are split across its threads
+    void buildPetrickFunction(PetrickComponent& component, ThreadPool* pool = nullptr) const;
+    
+    // Expand a component; if the budget stops the expansion, fall back to
+    // a greedy-seeded branch-and-bound search for the rest of the budget
+    void solveComponent(PetrickComponent& component, ThreadPool* pool = nullptr) const;
+    
+    // Print a component's clauses and intermediate SOP sizes
+    void printPetrickFunction(const PetrickComponent& component) const;
+    
+    // Remove duplicate and superset clauses, then order the rest for multiplication
+    void preprocessClauses(std::vector<PetrickTerm>& clauses) const;
+    
+    // Print clauses as a product of sums, e.g. "(PI1+PI2) · (PI3+PI4)"
+    void printClauses(const std::vector<PetrickTerm>& clauses) const;
     
     // Multiply SOP with a new clause (Boolean algebra)
-    PetrickSOP multiply(const PetrickSOP& sop, const PetrickTerm& clause);
+    // Large products are expanded on the pool when one is given. Returns an
+    // empty SOP if the time budget runs out during the expansion.
+    PetrickSOP multiply(const PetrickSOP& sop, const PetrickTerm& clause,
+                        ThreadPool* pool = nullptr) const;
+    
+    // Parallel multiply: partition the SOP across threads, deduplicate in
+    // hash shards, then absorb against a shared read-only index
+    // Gives exactly the same SOP as the serial multiply
+    PetrickSOP multiplyParallel(const PetrickSOP& sop, const PetrickTerm& clause,
+                                ThreadPool& pool) const;
+    
+    // Rough heap footprint of an SOP, checked against the memory budget
+    static size_t approxSopBytes(const PetrickSOP& sop);
+    
+    // Minimum product size (terms × clause PIs) for multiplyParallel
+    static const size_t PARALLEL_MULTIPLY_THRESHOLD = 8192;
+    
+    // SOP terms expanded between two reads of the clock in multiply
+    static const size_t TIME_CHECK_TERMS = 1024;
     
     // Simplify SOP by removing absorbed terms
-    void simplify(PetrickSOP& sop);
+    void simplify(PetrickSOP& sop) const;
     
     // Select the minimal solution from multiple options
     PetrickTerm selectMinimalCover(const PetrickSOP& solutions);
@@ -82,6 +143,14 @@ private:
     int countLiterals(const PetrickTerm& pis) const;
 
 public:
+    PetrickSolver() : num_threads(0) {}
+    
+    // Number of threads used to solve independent components (0 = hardware)
+    void setNumThreads(int threads) { num_threads = threads; }
+    
+    // Limit time/memory of the covering stage (best cover so far is kept)
+    void setBudget(const CoverBudget& limits) { budget = limits; }
+    
     // Main solving function
     void solve(const std::vector<Implicant>& pis, 
                const std::vector<int>& minterms,
@@ -92,6 +161,13 @@ public:
     std::vector<int> getAdditionalPIs() const { return additional_pi_indices; }
     std::vector<int> getAllSelectedPIs() const;
     std::vector<Implicant> getMinimalCover() const;
+    const std::vector<PetrickComponent>& getComponents() const { return components; }
+    
+    // Is the selected cover proven minimal? (false only if a budget ran out)
+    bool isProvenOptimal() const;
+    
+    // Best known lower bound on the number of PIs in a minimal cover
+    int getLowerBound() const;
     
     // Display detailed solving process
     void printDetailedSteps(const std::vector<int>& remaining_minterms,
@@ -99,4 +175,6 @@ public:
     
     // Display final solution
     void printSolution() const;
+    
+    const char* getName() const { return "petrick"; }
 };
@@ -1,18 +1,39 @@
 #include "PlaParser.h"
+#include "Cube.h"
 #include <fstream>
-#include <iostream>
 #include <string>
 #include <sstream>
 
 // Parses a PLA file line by line.
+const int PlaParser::MAX_INPUTS;
+
 bool PlaParser::parse(const std::string& filename){
     std::ifstream file(filename);
     if (!file.is_open()) {
-        std::cerr << "Error: cannot open " << filename << std::endl;
+        error = "Cannot open " + filename;
         return false;
     }
+    return parse(file);
+}
+
+// Checks a cube against .i; the engines index arrays with its positions.
+static bool isValidCube(const std::string& cube, int num_inputs) {
+    if ((int)cube.size() != num_inputs) return false;
+    for (char c : cube) {
+        if (c != '0' && c != '1' && c != '-') return false;
+    }
+    return true;
+}
+
+// Parses PLA text from a stream (e.g., a request received by the server).
+bool PlaParser::parse(std::istream& in){
+    static_assert(MAX_INPUTS <= Cube::MAX_VARS, "inputs beyond what cubes hold");
     std::string line;
-    while (std::getline(file, line)) {
+    int line_number = 0;
+    bool has_inputs = false;
+    error.clear();
+    while (std::getline(in, line)) {
+        line_number++;
         std::stringstream ss(line);
         std::string first_token;
         ss >> first_token; // Read the first word, automatically skipping whitespace
@@ -26,7 +47,12 @@ bool PlaParser::parse(const std::string& filename){
         if (first_token[0] == '.') {
             if (first_token == ".i") {
                 // .i: specifies the number of inputs.
-                ss >> this->num_inputs;
+                if (!(ss >> this->num_inputs) || num_inputs < 1 || num_inputs > MAX_INPUTS) {
+                    error = "Line " + std::to_string(line_number) + ": .i must be 1 to " +
+                            std::to_string(MAX_INPUTS);
+                    return false;
+                }
+                has_inputs = true;
                 this->var_names.resize(this->num_inputs);
             } else if (first_token == ".ilb") {
                 // .ilb: specifies the names of the input variables.
@@ -34,10 +60,13 @@ bool PlaParser::parse(const std::string& filename){
                     ss >> var_names[i];
                 }
             } else if (first_token == ".p") {
-                // .p: specifies the number of product terms. We reserve space for efficiency.
-                int num_products;
+                // .p: specifies the number of product terms. We reserve space for efficiency
+                // (only up to a sane count: the line is not trusted).
+                int num_products = 0;
                 ss >> num_products;
-                this->product_terms.reserve(num_products);
+                if (num_products > 0 && num_products <= (1 << 20)) {
+                    this->product_terms.reserve(num_products);
+                }
             } else if (first_token == ".e") {
                 // .e: marks the end of the file.
                 break;
@@ -46,6 +75,15 @@ bool PlaParser::parse(const std::string& filename){
         } else {
             // If the line does not start with '.', it's a product term.
             // The first token is the input cube.
+            if (!has_inputs) {
+                error = "Line " + std::to_string(line_number) + ": product term before .i";
+                return false;
+            }
+            if (!isValidCube(first_token, num_inputs)) {
+                error = "Line " + std::to_string(line_number) + ": cube \"" + first_token +
+                        "\" is not " + std::to_string(num_inputs) + " characters of 0, 1 and -";
+                return false;
+            }
             std::string output;
             ss >> output; // The second token is the output.
             if (!output.empty()) {
@@ -56,10 +94,16 @@ bool PlaParser::parse(const std::string& filename){
             }
         }
     }
-    file.close();
     return true;
 }
 
+// Sets the function directly; the variables stay unnamed.
+void PlaParser::setFunction(int inputs, const std::vector<ProductTerm>& terms){
+    this->num_inputs = inputs;
+    this->var_names.assign(inputs, "");
+    this->product_terms = terms;
+}
+
 // Getter for the number of inputs.
 int PlaParser::getNumInputs() const {
     return this->num_inputs;
@@ -1,4 +1,5 @@
 #pragma once
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -12,10 +13,24 @@ struct ProductTerm {
 // It extracts the number of inputs, variable names, and product terms.
 class PlaParser{
 public:
+    // Most inputs any engine handles (Cube::MAX_VARS)
+    static const int MAX_INPUTS = 128;
+
     // Parses the given PLA file.
-    // Returns true on success, false on failure (e.g., file not found).
+    // Returns true on success, false on failure (file not found, or a cube
+    // that is not exactly .i characters of '0', '1' and '-'); getError()
+    // then says why.
     bool parse(const std::string& filename);
 
+    // Parses PLA text from a stream; the same format as a file.
+    bool parse(std::istream& in);
+
+    // Sets the function directly, as if parsed (for the library API).
+    void setFunction(int inputs, const std::vector<ProductTerm>& terms);
+
+    // Why the last parse failed
+    const std::string& getError() const { return error; }
+
     // Getters for the parsed data.
     int getNumInputs() const;
     const std::vector<std::string>& getInputNames() const;
@@ -29,6 +44,7 @@ private:
     int num_inputs = 0; // Number of input variables (from .i line).
     std::vector<std::string> var_names; // Names of input variables (from .ilb line).
     std::vector<ProductTerm> product_terms; // List of product terms (output = "1" or "-")
+    std::string error;  // Why the last parse failed
     
     // Helper functions
     std::vector<std::string> expandCube(const std::string& cube) const;  // Expand cube with '-'
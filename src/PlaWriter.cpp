@@ -15,6 +15,17 @@ void PlaWriter::setMinimalCover(const std::vector<Implicant>& cover) {
     minimal_cover = cover;
 }
 
+// Record whether the cover is proven minimal
+void PlaWriter::setOptimality(bool proven, int term_lower_bound) {
+    proven_optimal = proven;
+    lower_bound = term_lower_bound;
+}
+
+// Record the minimization method
+void PlaWriter::setGenerator(const std::string& name) {
+    generator = name;
+}
+
 // Convert implicant to PLA cube format
 // The implicant value is already in the correct format (e.g., "-0-1")
 std::string PlaWriter::implicantToCube(const Implicant& imp) const {
@@ -28,13 +39,26 @@ bool PlaWriter::write(const std::string& filename) {
         std::cerr << "Error: Cannot write to " << filename << std::endl;
         return false;
     }
+    return write(file);
+}
+
+// Write minimized PLA to a stream
+bool PlaWriter::write(std::ostream& file) {
     
     // Write PLA header
     file << "# Minimized Boolean Function\n";
-    file << "# Generated by Quine-McCluskey + Petrick's Algorithm\n";
+    file << "# Generated by " << generator << "\n";
     file << "# Statistics:\n";
     file << "#   Product terms: " << getNumProductTerms() << "\n";
     file << "#   Total literals: " << getTotalLiterals() << "\n";
+    if (proven_optimal) {
+        file << "#   Optimality: proven optimal\n";
+    } else if (lower_bound <= 0) {
+        file << "#   Optimality: not proven (heuristic)\n";
+    } else {
+        file << "#   Optimality: not proven (lower bound " 
+             << lower_bound << " product terms)\n";
+    }
     file << "\n";
     
     // Write PLA format
@@ -64,8 +88,7 @@ bool PlaWriter::write(const std::string& filename) {
     // Write end marker
     file << ".e\n";
     
-    file.close();
-    return true;
+    return file.good();
 }
 
 // Get number of product terms
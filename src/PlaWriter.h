@@ -1,6 +1,7 @@
 #pragma once
 #include "QuineMcCluskey.h"
 #include "Petrick.h"
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -12,6 +13,9 @@ private:
     std::vector<std::string> input_names;
     std::string output_name;
     std::vector<Implicant> minimal_cover;
+    bool proven_optimal = true;  // Was the cover proven minimal?
+    int lower_bound = 0;         // Lower bound on product terms when not proven
+    std::string generator = "Quine-McCluskey + Petrick's Algorithm";
     
     // Convert implicant binary representation to PLA cube format
     // Example: "-0-1" stays as "-0-1"
@@ -26,10 +30,26 @@ public:
     // Set the minimal cover (result from Petrick's method)
     void setMinimalCover(const std::vector<Implicant>& cover);
     
+    // Record whether the cover is proven minimal (noted in the header comments)
+    void setOptimality(bool proven, int term_lower_bound);
+    
+    // Name of the minimization method (noted in the header comments)
+    void setGenerator(const std::string& name);
+    
     // Write the minimized PLA to file
     bool write(const std::string& filename);
+
+    // Write the minimized PLA to a stream (e.g., a server response)
+    bool write(std::ostream& out);
     
     // Calculate statistics
     int getNumProductTerms() const;
     int getTotalLiterals() const;
+
+    // Result as set above (for the result cache)
+    int getNumInputs() const { return num_inputs; }
+    const std::vector<Implicant>& getMinimalCover() const { return minimal_cover; }
+    bool isProvenOptimal() const { return proven_optimal; }
+    int getLowerBound() const { return lower_bound; }
+    const std::string& getGenerator() const { return generator; }
 };
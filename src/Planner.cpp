@@ -0,0 +1,259 @@
+#include "Planner.h"
+#include "Console.h"
+#include "SubsumptionIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+const int Planner::PETRICK_MAX_LOG2;
+const int Planner::EXACT_MAX_CORE_ROWS;
+const int Planner::CONSENSUS_MIN_RATIO;
+
+void Planner::analyzeInput(int num_inputs, int num_cubes,
+                           const std::vector<int>& minterms,
+                           const std::vector<int>& dont_cares) {
+    double space = std::ldexp(1.0, num_inputs);
+
+    stats.num_inputs = num_inputs;
+    stats.num_cubes = num_cubes;
+    stats.on_count = minterms.size();
+    stats.dc_count = dont_cares.size();
+    stats.on_density = minterms.size() / space;
+    stats.dc_density = dont_cares.size() / space;
+}
+
+void Planner::planPrimes() {
+    std::ostringstream why;
+    long long points = (long long)stats.on_count + stats.dc_count;
+
+    if (stats.num_cubes > 0 && points >= (long long)CONSENSUS_MIN_RATIO * stats.num_cubes) {
+        prime_engine = "consensus";
+        why << "at least " << CONSENSUS_MIN_RATIO << " minterms per input cube";
+    } else {
+        prime_engine = "qm";
+        why << "fewer than " << CONSENSUS_MIN_RATIO << " minterms per input cube";
+    }
+    prime_reason = why.str();
+}
+
+void Planner::printPrimePlan() const {
+    LOG(SUMMARY) << "\n[Planner] Prime Generation" << std::endl;
+    LOG(SUMMARY) << "  ✓ Input cubes: " << stats.num_cubes << ", minterms (on + dc): "
+                 << stats.on_count + stats.dc_count << std::endl;
+    LOG(SUMMARY) << "  → Prime generator: " << prime_engine << " (" << prime_reason << ")" << std::endl;
+}
+
+void Planner::planCover(const std::vector<Implicant>& pis,
+                        const std::vector<int>& minterms,
+                        const std::vector<int>& dont_cares,
+                        const CoverBudget& budget) {
+    PrimeImplicantChart chart;
+    chart.build(pis, minterms, dont_cares);
+
+    // Column sizes: how many PIs cover each on-set minterm
+    std::vector<PetrickTerm> clauses;
+    long long total = 0;
+    stats.max_column_size = 0;
+    for (int m : chart.getOnSetMinterms()) {
+        std::vector<int> covering = chart.getPIsCovering(m);
+        clauses.push_back(PetrickTerm(covering.begin(), covering.end()));
+        total += covering.size();
+        stats.max_column_size = std::max(stats.max_column_size, (int)covering.size());
+    }
+    stats.num_pis = pis.size();
+    stats.avg_column_size = clauses.empty() ? 0 : (double)total / clauses.size();
+
+    std::vector<int> literals;
+    for (const auto& pi : pis) {
+        literals.push_back(pi.value.size() - std::count(pi.value.begin(), pi.value.end(), '-'));
+    }
+
+    reduceToCore(clauses, literals);
+
+    // Worst-case size of Petrick's expansion, in bytes
+    // (same per-term estimate as PetrickSolver::approxSopBytes)
+    double term_size = stats.avg_column_size > 0 ? stats.petrick_rows / stats.avg_column_size : 0;
+    double petrick_bytes = std::pow(2.0, stats.petrick_log2_terms) *
+                           (sizeof(PetrickTerm) + 40 * std::max(1.0, term_size));
+
+    std::ostringstream why;
+    if (stats.petrick_rows == 0) {
+        cover_engine = "petrick";
+        why << "essential PIs cover the on-set";
+    } else if (stats.petrick_log2_terms <= PETRICK_MAX_LOG2 &&
+               !budget.exceedsMemory((size_t)std::min(petrick_bytes, 1e18))) {
+        cover_engine = "petrick";
+        why << "expansion of at most 2^" << PETRICK_MAX_LOG2 << " terms";
+    } else if (stats.core_rows <= EXACT_MAX_CORE_ROWS) {
+        cover_engine = "pb";
+        if (stats.petrick_log2_terms > PETRICK_MAX_LOG2) {
+            why << "expansion may exceed 2^" << PETRICK_MAX_LOG2 << " terms";
+        } else {
+            why << "expansion may exceed the memory limit";
+        }
+        why << ", cyclic core small enough for exact search";
+    } else {
+        cover_engine = "greedy";
+        why << "cyclic core has more than " << EXACT_MAX_CORE_ROWS << " minterms";
+    }
+    reason = why.str();
+}
+
+void Planner::reduceToCore(std::vector<PetrickTerm> clauses, const std::vector<int>& literals) {
+    stats.essential_pis = 0;
+    stats.petrick_rows = 0;
+    stats.petrick_log2_terms = 0;
+    bool first_pass = true;
+    bool changed = true;
+
+    while (changed && !clauses.empty()) {
+        changed = false;
+
+        // Essential PIs: a clause with a single PI forces it
+        PetrickTerm forced;
+        for (const auto& clause : clauses) {
+            if (clause.size() == 1) forced.insert(*clause.begin());
+        }
+        if (!forced.empty()) {
+            if (first_pass) stats.essential_pis = forced.size();
+            std::vector<PetrickTerm> kept;
+            for (const auto& clause : clauses) {
+                bool covered = false;
+                for (int pi : clause) {
+                    if (forced.count(pi)) {
+                        covered = true;
+                        break;
+                    }
+                }
+                if (!covered) kept.push_back(clause);
+            }
+            clauses.swap(kept);
+            changed = true;
+        }
+
+        // Row dominance: a clause containing another clause is implied by it
+        std::stable_sort(clauses.begin(), clauses.end(),
+                         [](const PetrickTerm& a, const PetrickTerm& b) {
+                             return a.size() < b.size();
+                         });
+        SubsumptionIndex index;
+        std::vector<PetrickTerm> rows;
+        for (const auto& clause : clauses) {
+            if (index.containsSubsetOf(clause)) {
+                changed = true;
+                continue;
+            }
+            index.insert(clause);
+            rows.push_back(clause);
+        }
+        clauses.swap(rows);
+
+        // This is where Petrick's method starts expanding
+        if (first_pass) {
+            stats.petrick_rows = clauses.size();
+            stats.petrick_log2_terms = log2ExpansionBound(clauses);
+            first_pass = false;
+        }
+
+        // Column dominance: drop a PI if another PI covers all of its
+        // remaining minterms with no more literals
+        std::map<int, std::vector<int>> columns;
+        for (size_t r = 0; r < clauses.size(); r++) {
+            for (int pi : clauses[r]) columns[pi].push_back(r);
+        }
+
+        // Only PIs sharing p's first minterm can dominate p
+        std::vector<int> dominated;
+        for (const auto& p : columns) {
+            for (int q_pi : clauses[p.second[0]]) {
+                const std::vector<int>& q_rows = columns[q_pi];
+                if (q_pi == p.first || literals[q_pi] > literals[p.first]) continue;
+                if (q_rows.size() < p.second.size()) continue;
+
+                // Identical columns with equal cost: keep the lower index
+                if (q_rows == p.second && literals[q_pi] == literals[p.first] &&
+                    q_pi > p.first) continue;
+
+                if (std::includes(q_rows.begin(), q_rows.end(),
+                                  p.second.begin(), p.second.end())) {
+                    dominated.push_back(p.first);
+                    break;
+                }
+            }
+        }
+        for (int pi : dominated) {
+            for (int r : columns[pi]) clauses[r].erase(pi);
+        }
+        if (!dominated.empty()) changed = true;
+    }
+
+    PetrickTerm cols;
+    for (const auto& clause : clauses) {
+        cols.insert(clause.begin(), clause.end());
+    }
+    stats.core_rows = clauses.size();
+    stats.core_cols = cols.size();
+}
+
+double Planner::log2ExpansionBound(const std::vector<PetrickTerm>& clauses) {
+    // Union-find over clauses sharing a PI, as in PetrickSolver::findComponents
+    std::vector<int> parent(clauses.size());
+    for (size_t i = 0; i < parent.size(); i++) parent[i] = i;
+    std::function<int(int)> find = [&parent, &find](int x) {
+        if (parent[x] != x) {
+            parent[x] = find(parent[x]);
+        }
+        return parent[x];
+    };
+
+    std::map<int, int> first_clause_of_pi;
+    for (size_t i = 0; i < clauses.size(); i++) {
+        for (int pi : clauses[i]) {
+            auto it = first_clause_of_pi.find(pi);
+            if (it == first_clause_of_pi.end()) {
+                first_clause_of_pi[pi] = i;
+            } else {
+                parent[find(i)] = find(it->second);
+            }
+        }
+    }
+
+    std::map<int, double> component_log2;
+    for (size_t i = 0; i < clauses.size(); i++) {
+        component_log2[find(i)] += std::log2((double)clauses[i].size());
+    }
+
+    // log2(sum of 2^x), scaled by the largest term to avoid overflow
+    double largest = 0;
+    for (const auto& c : component_log2) largest = std::max(largest, c.second);
+    double sum = 0;
+    for (const auto& c : component_log2) sum += std::pow(2.0, c.second - largest);
+    return clauses.empty() ? 0 : largest + std::log2(sum);
+}
+
+void Planner::printPlan() const {
+    if (!logEnabled(LogLevel::SUMMARY)) return;
+
+    console() << "\n[Planner] Engine Selection" << std::endl;
+    console() << std::fixed << std::setprecision(1);
+    console() << "  ✓ Inputs: " << stats.num_inputs
+              << ", input cubes: " << stats.num_cubes << std::endl;
+    console() << "  ✓ On-set: " << stats.on_count << " minterms ("
+              << stats.on_density * 100 << "%), don't cares: " << stats.dc_count
+              << " (" << stats.dc_density * 100 << "%)" << std::endl;
+    console() << "  ✓ Prime implicants: " << stats.num_pis
+              << ", PIs per minterm: avg " << stats.avg_column_size
+              << ", max " << stats.max_column_size << std::endl;
+    console() << "  ✓ Essential PIs: " << stats.essential_pis << std::endl;
+    console() << "  ✓ Petrick's function: " << stats.petrick_rows
+              << " clauses, expansion bound 2^" << stats.petrick_log2_terms << " terms" << std::endl;
+    console() << "  ✓ Cyclic core: " << stats.core_rows << " minterms x "
+              << stats.core_cols << " PIs" << std::endl;
+    console() << "  → Covering engine: " << cover_engine << " (" << reason << ")" << std::endl;
+    console().unsetf(std::ios::floatfield);
+    console() << std::setprecision(6);
+}
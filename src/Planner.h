@@ -0,0 +1,89 @@
+#pragma once
+#include "CoverBudget.h"
+#include "Petrick.h"
+#include <string>
+#include <vector>
+
+// Cheap statistics used to estimate how hard a covering problem is
+struct ProblemStats {
+    // From the parsed PLA
+    int num_inputs = 0;
+    int num_cubes = 0;                 // Product terms in the input file
+    int on_count = 0;
+    int dc_count = 0;
+    double on_density = 0;             // On-set minterms / 2^inputs
+    double dc_density = 0;             // Don't cares / 2^inputs
+
+    // From the prime implicant chart
+    int num_pis = 0;
+    double avg_column_size = 0;        // Average PIs covering an on-set minterm
+    int max_column_size = 0;
+    int essential_pis = 0;
+
+    // Petrick's method only takes essential PIs and drops dominated rows
+    // before expanding, so its size is estimated at that stage: the product
+    // of clause sizes of each independent component, summed, in log2
+    int petrick_rows = 0;
+    double petrick_log2_terms = 0;
+
+    // Cyclic core: what is left after essential PIs plus row and column
+    // dominance, repeated until nothing changes
+    int core_rows = 0;                 // Minterms left
+    int core_cols = 0;                 // PIs left
+};
+
+// Planner stage between PlaParser and the minimizers
+// Picks the prime generator from the input statistics:
+//   - consensus: the input cubes are few compared to their minterms, so
+//                working on cubes beats rebuilding them minterm by minterm
+//   - qm:        otherwise
+// and then the covering engine expected to be fastest for the problem at
+// hand, within the memory budget:
+//   - petrick: its expansion stays small (or nothing is left to expand)
+//   - pb:      the expansion would blow up but the cyclic core is small
+//              enough for exact search
+//   - greedy:  the core is too large for exact search
+// The decision and all estimates are logged so the thresholds can be tuned
+// against benchmark data.
+class Planner {
+private:
+    ProblemStats stats;
+    std::string prime_engine;
+    std::string prime_reason;          // Why prime_engine was chosen
+    std::string cover_engine;
+    std::string reason;                // Why cover_engine was chosen
+
+    // Reduce the clauses of the remaining minterms to the cyclic core
+    void reduceToCore(std::vector<PetrickTerm> clauses, const std::vector<int>& literals);
+
+    // log2 of the summed per-component products of clause sizes
+    static double log2ExpansionBound(const std::vector<PetrickTerm>& clauses);
+
+public:
+    // Thresholds of the cost model
+    static const int PETRICK_MAX_LOG2 = 20;       // Expansion of at most ~1M terms
+    static const int EXACT_MAX_CORE_ROWS = 4000;  // Larger cores go to the greedy engine
+    static const int CONSENSUS_MIN_RATIO = 8;     // Minterms per input cube for consensus
+
+    // Statistics from the parsed input
+    void analyzeInput(int num_inputs, int num_cubes,
+                      const std::vector<int>& minterms,
+                      const std::vector<int>& dont_cares);
+
+    // Choose the prime generator from the input statistics
+    void planPrimes();
+    void printPrimePlan() const;
+
+    // Statistics from the prime implicants, then choose the covering engine
+    void planCover(const std::vector<Implicant>& pis,
+                   const std::vector<int>& minterms,
+                   const std::vector<int>& dont_cares,
+                   const CoverBudget& budget);
+
+    // Log the estimates and the decision
+    void printPlan() const;
+
+    const ProblemStats& getStats() const { return stats; }
+    const std::string& getPrimeEngine() const { return prime_engine; }
+    const std::string& getCoverEngine() const { return cover_engine; }
+};
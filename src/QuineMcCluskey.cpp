@@ -1,4 +1,6 @@
 #include "QuineMcCluskey.h"
+#include "Console.h"
+#include "Stats.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
@@ -131,12 +133,15 @@ std::vector<Implicant> QuineMcCluskey::combineGroups(
     std::vector<std::vector<Implicant>>& groups) {
     
     std::vector<Implicant> new_implicants;
+    long long comparisons = 0, combines = 0, duplicates = 0;
     
     // Try combining group i with group i+1
     for (size_t i = 0; i < groups.size() - 1; ++i) {
         for (auto& imp1 : groups[i]) {
             for (auto& imp2 : groups[i + 1]) {
+                comparisons++;
                 if (imp1.canCombineWith(imp2)) {
+                    combines++;
                     // Mark both as used
                     imp1.used = true;
                     imp2.used = true;
@@ -156,12 +161,20 @@ std::vector<Implicant> QuineMcCluskey::combineGroups(
                     
                     if (!exists) {
                         new_implicants.push_back(combined);
+                    } else {
+                        duplicates++;
                     }
                 }
             }
         }
     }
     
+    if (RunStats* stats = activeStats()) {
+        stats->add("qm.comparisons", comparisons);
+        stats->add("qm.combines", combines);
+        stats->add("qm.duplicates_rejected", duplicates);
+    }
+    
     return new_implicants;
 }
 
@@ -191,6 +204,11 @@ void QuineMcCluskey::findPrimeImplicants(
     
     while (has_new_implicants) {
         iteration++;
+        std::string timer_name = "qm.column" + std::to_string(iteration);
+        ScopedTimer column_timer(timer_name.c_str());
+        if (RunStats* stats = activeStats()) {
+            stats->append("qm.column_sizes", current_implicants.size());
+        }
         
         // Group current implicants by number of 1's
         auto groups = groupByOnes(current_implicants);
@@ -232,32 +250,36 @@ const std::vector<Implicant>& QuineMcCluskey::getPrimeImplicants() const {
 void QuineMcCluskey::printDetailedSteps(
     const std::vector<int>& minterms, 
     const std::vector<int>& dont_cares) {
+    // This pass repeats the work of findPrimeImplicants for the printout:
+    // skip it below the detailed level and keep it out of the statistics
+    if (!logEnabled(LogLevel::DETAILED)) return;
+    ScopedStats not_counted(nullptr);
     
-    std::cout << "\n┌─────────────────────────────────────────────────────────┐" << std::endl;
-    std::cout << "│  Quine-McCluskey Algorithm - Detailed Steps            │" << std::endl;
-    std::cout << "└─────────────────────────────────────────────────────────┘" << std::endl;
+    console() << "\n┌─────────────────────────────────────────────────────────┐" << std::endl;
+    console() << "│  Quine-McCluskey Algorithm - Detailed Steps            │" << std::endl;
+    console() << "└─────────────────────────────────────────────────────────┘" << std::endl;
     
     // Combine all minterms and don't cares
     std::vector<Implicant> current_implicants;
     
-    std::cout << "\n📌 Initial Minterms:" << std::endl;
-    std::cout << "   On-set: ";
+    console() << "\n📌 Initial Minterms:" << std::endl;
+    console() << "   On-set: ";
     for (size_t i = 0; i < minterms.size(); ++i) {
-        std::cout << "m" << minterms[i];
-        if (i < minterms.size() - 1) std::cout << ", ";
+        console() << "m" << minterms[i];
+        if (i < minterms.size() - 1) console() << ", ";
     }
-    std::cout << std::endl;
+    console() << std::endl;
     
-    std::cout << "   Don't cares: ";
+    console() << "   Don't cares: ";
     if (dont_cares.empty()) {
-        std::cout << "(none)";
+        console() << "(none)";
     } else {
         for (size_t i = 0; i < dont_cares.size(); ++i) {
-            std::cout << "m" << dont_cares[i];
-            if (i < dont_cares.size() - 1) std::cout << ", ";
+            console() << "m" << dont_cares[i];
+            if (i < dont_cares.size() - 1) console() << ", ";
         }
     }
-    std::cout << std::endl;
+    console() << std::endl;
     
     // Create initial implicants
     for (int m : minterms) {
@@ -277,9 +299,9 @@ void QuineMcCluskey::printDetailedSteps(
     while (true) {
         iteration++;
         
-        std::cout << "\n" << std::string(60, '=') << std::endl;
-        std::cout << "🔄 Column " << iteration << " - Grouping by number of 1's" << std::endl;
-        std::cout << std::string(60, '=') << std::endl;
+        console() << "\n" << std::string(60, '=') << std::endl;
+        console() << "🔄 Column " << iteration << " - Grouping by number of 1's" << std::endl;
+        console() << std::string(60, '=') << std::endl;
         
         // Group by number of 1's
         auto groups = groupByOnes(current_implicants);
@@ -288,28 +310,28 @@ void QuineMcCluskey::printDetailedSteps(
         for (size_t i = 0; i < groups.size(); ++i) {
             if (groups[i].empty()) continue;
             
-            std::cout << "\nGroup " << i << " (has " << i << " ones):" << std::endl;
-            std::cout << std::string(60, '-') << std::endl;
+            console() << "\nGroup " << i << " (has " << i << " ones):" << std::endl;
+            console() << std::string(60, '-') << std::endl;
             
             for (const auto& imp : groups[i]) {
-                std::cout << "  " << imp.value 
+                console() << "  " << imp.value 
                          << "  (m" << imp.mintermsToString() << ")" << std::endl;
             }
         }
         
         // Try combinations
-        std::cout << "\n🔀 Attempting combinations..." << std::endl;
+        console() << "\n🔀 Attempting combinations..." << std::endl;
         std::vector<Implicant> new_implicants = combineGroups(groups);
         
         if (new_implicants.empty()) {
-            std::cout << "   ❌ No more combinations possible." << std::endl;
+            console() << "   ❌ No more combinations possible." << std::endl;
             
             // All remaining are prime implicants
-            std::cout << "\n✅ Prime Implicants found in this column:" << std::endl;
+            console() << "\n✅ Prime Implicants found in this column:" << std::endl;
             for (auto& group : groups) {
                 for (auto& imp : group) {
                     if (!imp.used) {
-                        std::cout << "   • " << imp.value 
+                        console() << "   • " << imp.value 
                                  << "  (m" << imp.mintermsToString() << ")" << std::endl;
                         all_prime_implicants.push_back(imp);
                     }
@@ -318,9 +340,9 @@ void QuineMcCluskey::printDetailedSteps(
             break;
         }
         
-        std::cout << "   ✓ Found " << new_implicants.size() << " new combinations:" << std::endl;
+        console() << "   ✓ Found " << new_implicants.size() << " new combinations:" << std::endl;
         for (const auto& imp : new_implicants) {
-            std::cout << "      " << imp.value 
+            console() << "      " << imp.value 
                      << "  (m" << imp.mintermsToString() << ")" << std::endl;
         }
         
@@ -335,9 +357,9 @@ void QuineMcCluskey::printDetailedSteps(
         }
         
         if (!pis_this_round.empty()) {
-            std::cout << "\n✅ Prime Implicants found in this column:" << std::endl;
+            console() << "\n✅ Prime Implicants found in this column:" << std::endl;
             for (const auto& pi : pis_this_round) {
-                std::cout << "   • " << pi.value 
+                console() << "   • " << pi.value 
                          << "  (m" << pi.mintermsToString() << ")" << std::endl;
                 all_prime_implicants.push_back(pi);
             }
@@ -347,14 +369,14 @@ void QuineMcCluskey::printDetailedSteps(
     }
     
     // Final summary
-    std::cout << "\n" << std::string(60, '=') << std::endl;
-    std::cout << "🎯 FINAL PRIME IMPLICANTS" << std::endl;
-    std::cout << std::string(60, '=') << std::endl;
+    console() << "\n" << std::string(60, '=') << std::endl;
+    console() << "🎯 FINAL PRIME IMPLICANTS" << std::endl;
+    console() << std::string(60, '=') << std::endl;
     
     for (size_t i = 0; i < all_prime_implicants.size(); ++i) {
-        std::cout << "PI" << (i + 1) << ": " << all_prime_implicants[i].value 
+        console() << "PI" << (i + 1) << ": " << all_prime_implicants[i].value 
                  << "  covers m" << all_prime_implicants[i].mintermsToString() << std::endl;
     }
     
-    std::cout << "\nTotal: " << all_prime_implicants.size() << " Prime Implicants" << std::endl;
+    console() << "\nTotal: " << all_prime_implicants.size() << " Prime Implicants" << std::endl;
 }
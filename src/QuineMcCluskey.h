@@ -36,6 +36,8 @@ public:
 
 // Implements the Quine-McCluskey algorithm for finding prime implicants
 class QuineMcCluskey {
+    friend class KernelBench;               // tools/kernel_bench times the private kernels
+
 private:
     int num_vars;                           // Number of input variables
     std::vector<Implicant> prime_implicants; // Final list of prime implicants
@@ -0,0 +1,147 @@
+#include "ResultCache.h"
+#include "Console.h"
+#include "Sha256.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const int ResultCache::MAX_MINTERM_VARS;
+
+// First line of every entry; bump when the format changes
+static const char* const ENTRY_HEADER = "minimize-cache 1";
+
+// Makes temporary file names unique within the process
+static std::atomic<unsigned> temp_sequence(0);
+
+ResultCache::ResultCache(const std::string& directory)
+    : dir(directory), hits(0), misses(0), stores(0) {
+}
+
+bool ResultCache::open() {
+    if (mkdir(dir.c_str(), 0777) != 0 && errno != EEXIST) {
+        std::cerr << "Cannot create cache directory " << dir << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::string ResultCache::entryPath(const std::string& key) const {
+    return dir + "/" + key + ".cover";
+}
+
+std::string ResultCache::problemKey(int num_inputs, std::vector<int> minterms,
+                                    std::vector<int> dont_cares, const std::string& options) {
+    std::sort(minterms.begin(), minterms.end());
+    minterms.erase(std::unique(minterms.begin(), minterms.end()), minterms.end());
+
+    // A minterm in both sets is in the on-set
+    std::sort(dont_cares.begin(), dont_cares.end());
+    dont_cares.erase(std::unique(dont_cares.begin(), dont_cares.end()), dont_cares.end());
+    std::vector<int> dc_only;
+    std::set_difference(dont_cares.begin(), dont_cares.end(), minterms.begin(), minterms.end(),
+                        std::back_inserter(dc_only));
+
+    std::ostringstream problem;
+    problem << "minterms\ni " << num_inputs << "\n" << options << "\non";
+    for (int m : minterms) problem << " " << m;
+    problem << "\ndc";
+    for (int d : dc_only) problem << " " << d;
+    problem << "\n";
+    return Sha256::hash(problem.str());
+}
+
+std::string ResultCache::problemKey(int num_inputs, const std::vector<ProductTerm>& terms,
+                                    const std::string& options) {
+    std::vector<std::string> lines;
+    for (const auto& term : terms) {
+        lines.push_back(term.cube + " " + term.output);
+    }
+    std::sort(lines.begin(), lines.end());
+    lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+
+    std::ostringstream problem;
+    problem << "cubes\ni " << num_inputs << "\n" << options << "\n";
+    for (const auto& line : lines) problem << line << "\n";
+    return Sha256::hash(problem.str());
+}
+
+bool ResultCache::load(const std::string& key, CachedResult& result) {
+    std::ifstream file(entryPath(key));
+    std::string line;
+    if (!file || !std::getline(file, line) || line != ENTRY_HEADER) {
+        misses++;
+        return false;
+    }
+
+    result = CachedResult();
+    int num_cubes = -1;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string tag;
+        fields >> tag;
+        if (tag == "i") {
+            fields >> result.num_inputs;
+        } else if (tag == "optimal") {
+            fields >> result.proven_optimal >> result.lower_bound;
+        } else if (tag == "generator") {
+            std::getline(fields >> std::ws, result.generator);
+        } else if (tag == "p") {
+            fields >> num_cubes;
+        } else if (tag == "cube") {
+            std::string cube;
+            fields >> cube;
+            result.cubes.push_back(cube);
+        }
+    }
+
+    // A damaged entry counts as a miss (it is rewritten after minimizing)
+    if (num_cubes != (int)result.cubes.size()) {
+        misses++;
+        return false;
+    }
+    hits++;
+    return true;
+}
+
+bool ResultCache::store(const std::string& key, const CachedResult& result) {
+    std::ostringstream temp_name;
+    temp_name << dir << "/.tmp." << getpid() << "." << temp_sequence++ << "." << key;
+    std::string temp_path = temp_name.str();
+
+    {
+        std::ofstream file(temp_path);
+        if (!file) return false;
+        file << ENTRY_HEADER << "\n";
+        file << "i " << result.num_inputs << "\n";
+        file << "optimal " << result.proven_optimal << " " << result.lower_bound << "\n";
+        file << "generator " << result.generator << "\n";
+        file << "p " << result.cubes.size() << "\n";
+        for (const auto& cube : result.cubes) {
+            file << "cube " << cube << "\n";
+        }
+        if (!file.flush()) {
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+
+    // rename() replaces the entry atomically, even if another process wrote it meanwhile
+    if (std::rename(temp_path.c_str(), entryPath(key).c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    stores++;
+    return true;
+}
+
+void ResultCache::printCounters() const {
+    LOG(SUMMARY) << "  ✓ Cache hits: " << hits.load() << ", misses: " << misses.load()
+                 << ", stores: " << stores.load() << std::endl;
+}
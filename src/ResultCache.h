@@ -0,0 +1,67 @@
+#pragma once
+#include "PlaParser.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+// A minimized cover as stored in the cache
+struct CachedResult {
+    int num_inputs = 0;
+    std::vector<std::string> cubes;
+    bool proven_optimal = false;
+    int lower_bound = 0;
+    std::string generator;
+};
+
+// Persistent on-disk cache of minimization results
+// One file per problem, named after the SHA-256 of the normalized problem:
+// input count, sorted and deduplicated on-set and don't-care minterms, and
+// the options that change the result (minimizer, prime generator and
+// covering engine, --all-optimal and the covering limits). Two
+// PLA files describing the same function with different cubes share an
+// entry. Functions with more than MAX_MINTERM_VARS inputs are keyed by
+// their sorted cubes instead, since their minterms are too many to list.
+//
+// Entries are written to a temporary file and renamed into place, so
+// processes sharing the directory only ever see complete entries.
+class ResultCache {
+private:
+    std::string dir;                   // Empty: cache disabled
+
+    // Counters for printCounters; batch mode shares the cache between threads
+    std::atomic<int> hits;
+    std::atomic<int> misses;
+    std::atomic<int> stores;
+
+    std::string entryPath(const std::string& key) const;
+
+public:
+    static const int MAX_MINTERM_VARS = 20;
+
+    explicit ResultCache(const std::string& directory = "");
+
+    bool isEnabled() const { return !dir.empty(); }
+
+    // Create the cache directory if needed; false if it cannot be used
+    bool open();
+
+    // Key of a problem given by its minterms
+    static std::string problemKey(int num_inputs, std::vector<int> minterms,
+                                  std::vector<int> dont_cares, const std::string& options);
+
+    // Key of a problem given by its cubes (for many inputs)
+    static std::string problemKey(int num_inputs, const std::vector<ProductTerm>& terms,
+                                  const std::string& options);
+
+    // Load an entry; counts a hit or a miss
+    bool load(const std::string& key, CachedResult& result);
+
+    // Store an entry atomically (temporary file + rename)
+    bool store(const std::string& key, const CachedResult& result);
+
+    int getHits() const { return hits.load(); }
+    int getMisses() const { return misses.load(); }
+    int getStores() const { return stores.load(); }
+
+    void printCounters() const;
+};
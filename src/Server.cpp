@@ -0,0 +1,394 @@
+#include "Server.h"
+#include "Console.h"
+#include "Sha256.h"
+#include "ThreadPool.h"
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+const int MinimizeServer::MAX_TRUTH_TABLE_VARS;
+const size_t MinimizeServer::MAX_REQUEST_BYTES;
+const size_t MinimizeServer::MEMO_CAPACITY;
+const size_t MinimizeServer::MAX_CONNECTIONS;
+const int MinimizeServer::MAX_MINTERM_INPUTS;
+const int MinimizeServer::REQUEST_TIMEOUT_S;
+
+// How often the accept loop checks for a shutdown (ms)
+static const int ACCEPT_POLL_MS = 200;
+
+static volatile sig_atomic_t signal_received = 0;
+
+static void onSignal(int) {
+    signal_received = 1;
+}
+
+MinimizeServer::MinimizeServer(const MinimizerOptions& run_options, int jobs, ResultCache& result_cache)
+    : options(run_options), num_jobs(jobs), cache(result_cache),
+      requests(0), memo_hits(0), failures(0), stopping(false), listen_fd(-1) {
+    wake_pipe[0] = wake_pipe[1] = -1;
+    if (options.max_minterm_inputs > MAX_MINTERM_INPUTS) {
+        options.max_minterm_inputs = MAX_MINTERM_INPUTS;
+    }
+}
+
+// One hex digit string of a truth table into the points it sets
+static bool hexToPoints(const std::string& hex, int num_inputs, std::vector<bool>& points) {
+    size_t digits = num_inputs >= 2 ? (size_t(1) << (num_inputs - 2)) : 1;
+    if (hex.size() != digits) return false;
+
+    for (size_t i = 0; i < digits; i++) {
+        char c = std::tolower(hex[i]);
+        if (!std::isxdigit(c)) return false;
+        int value = std::isdigit(c) ? c - '0' : c - 'a' + 10;
+        size_t first = (digits - 1 - i) * 4;      // Most significant digit first
+        for (int b = 0; b < 4; b++) {
+            if (!((value >> b) & 1)) continue;
+            if (first + b >= points.size()) return false;
+            points[first + b] = true;
+        }
+    }
+    return true;
+}
+
+bool MinimizeServer::truthTableToPla(const std::string& arguments, std::string& pla_text,
+                                     std::string& error) {
+    std::istringstream fields(arguments);
+    int num_inputs;
+    std::string on_hex, dc_hex;
+    if (!(fields >> num_inputs >> on_hex)) {
+        error = "Usage: TT <inputs> <on-hex> [<dc-hex>]";
+        return false;
+    }
+    fields >> dc_hex;
+    if (num_inputs < 1 || num_inputs > MAX_TRUTH_TABLE_VARS) {
+        error = "Truth tables have 1 to " + std::to_string(MAX_TRUTH_TABLE_VARS) + " inputs";
+        return false;
+    }
+
+    size_t size = size_t(1) << num_inputs;
+    std::vector<bool> on(size, false), dc(size, false);
+    if (!hexToPoints(on_hex, num_inputs, on) ||
+        (!dc_hex.empty() && !hexToPoints(dc_hex, num_inputs, dc))) {
+        error = "Malformed truth table for " + std::to_string(num_inputs) + " inputs";
+        return false;
+    }
+
+    std::ostringstream text;
+    std::ostringstream terms;
+    int count = 0;
+    for (size_t m = 0; m < size; m++) {
+        if (!on[m] && !dc[m]) continue;
+        if (on[m] && dc[m]) {
+            error = "Minterm " + std::to_string(m) + " is both on and don't care";
+            return false;
+        }
+        for (int i = num_inputs - 1; i >= 0; i--) {
+            terms << ((m >> i) & 1);
+        }
+        terms << (on[m] ? " 1\n" : " -\n");
+        count++;
+    }
+
+    text << ".i " << num_inputs << "\n.o 1\n.ilb";
+    for (int i = 0; i < num_inputs; i++) {
+        text << " " << char('A' + i);
+    }
+    text << "\n.ob F\n.p " << count << "\n" << terms.str() << ".e\n";
+    pla_text = text.str();
+    return true;
+}
+
+std::string MinimizeServer::minimizeRequest(const std::string& request, const std::string& pla_text) {
+    std::string key = Sha256::hash(request);
+    {
+        std::lock_guard<std::mutex> lock(memo_mutex);
+        auto found = memo.find(key);
+        if (found != memo.end()) {
+            memo_hits++;
+            return found->second;
+        }
+    }
+
+    std::string output;
+    MinimizeResult result;
+    try {
+        result = minimizePlaText(options, pla_text, output, cache);
+    } catch (const std::exception& e) {
+        result.error = std::string("Exception: ") + e.what();
+    }
+    if (!result.ok) {
+        failures++;
+        return "ERR " + result.error + "\n";
+    }
+
+    std::ostringstream reply;
+    reply << "OK " << result.product_terms << " " << result.literals << " "
+          << (result.proven_optimal ? 1 : 0) << " " << output.size() << "\n" << output;
+
+    std::lock_guard<std::mutex> lock(memo_mutex);
+    if (memo.size() >= MEMO_CAPACITY) memo.clear();
+    memo[key] = reply.str();
+    return reply.str();
+}
+
+std::string MinimizeServer::handleRequest(const std::string& header, ServerChannel& channel,
+                                          bool& close_connection) {
+    std::istringstream fields(header);
+    std::string command;
+    fields >> command;
+
+    if (command == "PLA") {
+        requests++;
+        size_t bytes;
+        std::string text;
+        if (!(fields >> bytes) || bytes > MAX_REQUEST_BYTES) {
+            // The body cannot be skipped, so the connection ends here
+            failures++;
+            close_connection = true;
+            return "ERR Bad PLA request header\n";
+        }
+        if (!channel.readBytes(bytes, text)) {
+            close_connection = true;
+            return "";
+        }
+        return minimizeRequest(header + "\n" + text, text);
+    }
+
+    if (command == "TT") {
+        requests++;
+        std::string pla_text, error;
+        if (!truthTableToPla(header.substr(2), pla_text, error)) {
+            failures++;
+            return "ERR " + error + "\n";
+        }
+        return minimizeRequest(header, pla_text);
+    }
+
+    if (command == "STATS") {
+        std::ostringstream reply;
+        reply << "STATS requests=" << requests.load() << " memo_hits=" << memo_hits.load()
+              << " failures=" << failures.load() << " cache_hits=" << cache.getHits()
+              << " cache_misses=" << cache.getMisses() << "\n";
+        return reply.str();
+    }
+
+    if (command == "SHUTDOWN") {
+        close_connection = true;
+        stop();
+        return "BYE\n";
+    }
+
+    return "ERR Unknown request: " + command + "\n";
+}
+
+bool MinimizeServer::serveRequest(ServerChannel& channel) {
+    std::string header;
+    do {
+        if (!channel.readLine(header)) {
+            if (channel.lineTooLong()) {
+                failures++;
+                channel.writeAll("ERR Request line longer than " +
+                                 std::to_string(ServerChannel::MAX_LINE_BYTES) + " bytes\n");
+            }
+            return false;
+        }
+    } while (header.empty());
+
+    bool close_connection = false;
+    std::string reply = handleRequest(header, channel, close_connection);
+    return channel.writeAll(reply) && !close_connection;
+}
+
+void MinimizeServer::serveQueued(int fd) {
+    // The minimization steps print nothing in the server (and do not format)
+    std::ostream quiet(nullptr);
+    ScopedConsole silence(&quiet);
+    ScopedLogLevel no_tracing(LogLevel::QUIET);
+
+    ServerChannel* channel;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        channel = connections[fd].get();
+    }
+
+    // Requests the client sent ahead are already buffered: answer them here
+    bool open;
+    do {
+        open = serveRequest(*channel);
+    } while (open && !stopping && channel->hasBufferedInput());
+
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        busy.erase(fd);
+        if (!open || stopping) {
+            connections.erase(fd);
+            close(fd);
+        }
+    }
+    wake();
+}
+
+void MinimizeServer::serveConnection(int in_fd, int out_fd) {
+    std::ostream quiet(nullptr);
+    ScopedConsole silence(&quiet);
+    ScopedLogLevel no_tracing(LogLevel::QUIET);
+
+    ServerChannel channel(in_fd, out_fd);
+    while (!stopping && serveRequest(channel)) {
+    }
+}
+
+void MinimizeServer::acceptConnection() {
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0) return;
+
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex);
+        if (connections.size() < MAX_CONNECTIONS) {
+            // A client that stops halfway through a request frees its worker
+            struct timeval timeout = {REQUEST_TIMEOUT_S, 0};
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            connections[fd].reset(new ServerChannel(fd, fd));
+            return;
+        }
+    }
+    ServerChannel(fd, fd).writeAll("ERR Too many connections (at most " +
+                                   std::to_string(MAX_CONNECTIONS) + ")\n");
+    close(fd);
+}
+
+void MinimizeServer::wake() {
+    if (wake_pipe[1] < 0) return;
+    char byte = 0;
+    if (write(wake_pipe[1], &byte, 1) < 0) {
+        // Pipe full: the loop is woken already
+    }
+}
+
+void MinimizeServer::stop() {
+    stopping = true;
+    wake();
+}
+
+int MinimizeServer::run(const std::string& socket_path) {
+    // A client going away must not kill the server
+    signal(SIGPIPE, SIG_IGN);
+
+    if (socket_path == "-") {
+        serveConnection(STDIN_FILENO, STDOUT_FILENO);
+        return 0;
+    }
+
+    struct sockaddr_un address;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "[Error] Socket path too long: " << socket_path << std::endl;
+        return 1;
+    }
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+
+    listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socket_path.c_str());
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listen_fd, 64) != 0) {
+        std::cerr << "[Error] Cannot listen on " << socket_path << ": " << std::strerror(errno)
+                  << std::endl;
+        if (listen_fd >= 0) close(listen_fd);
+        return 1;
+    }
+    if (pipe(wake_pipe) != 0) {
+        std::cerr << "[Error] Cannot create a pipe: " << std::strerror(errno) << std::endl;
+        close(listen_fd);
+        return 1;
+    }
+    fcntl(wake_pipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(wake_pipe[1], F_SETFL, O_NONBLOCK);
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = onSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    {
+        ThreadPool pool(num_jobs);
+        LOG(SUMMARY) << "====================================" << std::endl;
+        LOG(SUMMARY) << "  Minimization Server" << std::endl;
+        LOG(SUMMARY) << "====================================" << std::endl;
+        LOG(SUMMARY) << "Socket:  " << socket_path << std::endl;
+        LOG(SUMMARY) << "Workers: " << pool.size() << std::endl;
+        LOG(SUMMARY) << "Cache:   " << (cache.isEnabled() ? "on disk and in memory" : "in memory")
+                     << std::endl;
+
+        std::vector<struct pollfd> waiting;
+        while (!stopping && !signal_received) {
+            // The listening socket, the wake-up pipe and the idle connections
+            waiting.clear();
+            waiting.push_back({listen_fd, POLLIN, 0});
+            waiting.push_back({wake_pipe[0], POLLIN, 0});
+            {
+                std::lock_guard<std::mutex> lock(connections_mutex);
+                for (const auto& connection : connections) {
+                    if (!busy.count(connection.first)) waiting.push_back({connection.first, POLLIN, 0});
+                }
+            }
+            if (poll(waiting.data(), waiting.size(), ACCEPT_POLL_MS) <= 0) continue;
+
+            if (waiting[1].revents) {
+                char drained[64];
+                while (read(wake_pipe[0], drained, sizeof(drained)) > 0) {
+                }
+            }
+
+            // A request (or the end of the input) on an idle connection
+            for (size_t i = 2; i < waiting.size() && !stopping; i++) {
+                if (!waiting[i].revents) continue;
+                int fd = waiting[i].fd;
+                {
+                    std::lock_guard<std::mutex> lock(connections_mutex);
+                    busy.insert(fd);
+                }
+                pool.submit([this, fd]() { serveQueued(fd); });
+            }
+
+            if (waiting[0].revents & POLLIN) acceptConnection();
+        }
+
+        // Idle connections end now; busy ones after their current request,
+        // before the pool is destroyed
+        {
+            std::lock_guard<std::mutex> lock(connections_mutex);
+            stopping = true;
+            for (auto it = connections.begin(); it != connections.end();) {
+                if (busy.count(it->first)) {
+                    ++it;
+                } else {
+                    close(it->first);
+                    it = connections.erase(it);
+                }
+            }
+        }
+        close(listen_fd);
+        unlink(socket_path.c_str());
+    }
+    close(wake_pipe[0]);
+    close(wake_pipe[1]);
+
+    LOG(SUMMARY) << "\n[Summary] " << requests.load() << " requests, " << memo_hits.load()
+                 << " answered from memory, " << failures.load() << " failed" << std::endl;
+    if (cache.isEnabled()) {
+        cache.printCounters();
+    }
+    return 0;
+}
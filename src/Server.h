@@ -0,0 +1,102 @@
+#pragma once
+#include "Minimizer.h"
+#include "ResultCache.h"
+#include "ServerChannel.h"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+// Long-running minimization server
+// Saves the process start-up of one minimize run per function and keeps its
+// state warm between requests: the result cache (--cache-dir) and an
+// in-memory table of recent replies. It listens on a Unix domain socket,
+// or reads requests from stdin and answers on stdout when the socket path
+// is "-". The accept loop polls the idle connections and hands each request
+// to a worker of a ThreadPool, so several clients are answered at once and
+// an idle client holds no worker; the requests of one connection are
+// answered in order. Clients beyond MAX_CONNECTIONS are turned away, and
+// the exact engine takes at most MAX_MINTERM_INPUTS inputs: it expands
+// 2^inputs minterms, which one small request could otherwise demand.
+//
+// Protocol: a request is a header line, for PLA text followed by the text.
+//   PLA <bytes>\n<PLA text>              minimize a PLA file's contents
+//   TT <inputs> <on-hex> [<dc-hex>]\n    minimize a truth table: bit m of the
+//                                        hex number is minterm m, most
+//                                        significant digit first
+//   STATS\n                              counters of the server
+//   SHUTDOWN\n                           stop accepting connections
+// Replies:
+//   OK <terms> <literals> <optimal 0|1> <bytes>\n<minimized PLA text>
+//   STATS requests=N ...\n
+//   BYE\n
+//   ERR <message>\n
+class MinimizeServer {
+public:
+    static const int MAX_TRUTH_TABLE_VARS = 16;
+    static const size_t MAX_REQUEST_BYTES = 64 << 20;
+    static const size_t MEMO_CAPACITY = 4096;      // Replies kept in memory
+    static const size_t MAX_CONNECTIONS = 256;
+    static const int MAX_MINTERM_INPUTS = 20;
+    static const int REQUEST_TIMEOUT_S = 30;       // Longest wait for the rest of a request
+
+private:
+    MinimizerOptions options;
+    int num_jobs;                                  // Worker threads (0 = all cores)
+    ResultCache& cache;
+
+    // Replies of recent requests, keyed by the SHA-256 of the request;
+    // emptied when it reaches MEMO_CAPACITY
+    std::mutex memo_mutex;
+    std::unordered_map<std::string, std::string> memo;
+
+    std::atomic<int> requests;
+    std::atomic<int> memo_hits;
+    std::atomic<int> failures;
+
+    // Shutdown: stop accepting and end the open connections after their
+    // current request
+    std::atomic<bool> stopping;
+    int listen_fd;
+    int wake_pipe[2];                              // Wakes the accept loop's poll
+
+    // Open connections by socket; busy ones have a request in the pool and
+    // are not polled until it is answered
+    std::mutex connections_mutex;
+    std::map<int, std::unique_ptr<ServerChannel>> connections;
+    std::set<int> busy;
+
+    // Read and answer one request; false when the connection is to end
+    bool serveRequest(ServerChannel& channel);
+
+    // Pool task: the requests waiting on connection fd
+    void serveQueued(int fd);
+
+    // stdin/stdout mode: every request of the one connection
+    void serveConnection(int in_fd, int out_fd);
+
+    void acceptConnection();
+    void wake();
+
+    // Answer one request; sets close_connection for SHUTDOWN or a broken frame
+    std::string handleRequest(const std::string& header, ServerChannel& channel,
+                              bool& close_connection);
+
+    // Minimize PLA text (through the memo) and format the reply
+    std::string minimizeRequest(const std::string& request, const std::string& pla_text);
+
+    void stop();
+
+public:
+    MinimizeServer(const MinimizerOptions& run_options, int jobs, ResultCache& result_cache);
+
+    // Serve until SHUTDOWN, SIGINT or SIGTERM ("-": stdin/stdout until end of input)
+    int run(const std::string& socket_path);
+
+    // "TT" arguments to PLA text; false with an error for a malformed table
+    static bool truthTableToPla(const std::string& arguments, std::string& pla_text,
+                                std::string& error);
+};
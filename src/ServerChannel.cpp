@@ -0,0 +1,122 @@
+#include "ServerChannel.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+const size_t ServerChannel::MAX_LINE_BYTES;
+
+ServerChannel::ServerChannel(int input_fd, int output_fd)
+    : in_fd(input_fd), out_fd(output_fd), pos(0), line_too_long(false) {
+}
+
+bool ServerChannel::fill() {
+    // Drop the consumed part before reading more
+    if (pos > 0) {
+        buffer.erase(0, pos);
+        pos = 0;
+    }
+    char chunk[65536];
+    ssize_t n;
+    do {
+        n = ::read(in_fd, chunk, sizeof(chunk));
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0) return false;
+    buffer.append(chunk, n);
+    return true;
+}
+
+bool ServerChannel::readLine(std::string& line) {
+    size_t newline;
+    while ((newline = buffer.find('\n', pos)) == std::string::npos) {
+        if (buffer.size() - pos > MAX_LINE_BYTES) {
+            line_too_long = true;
+            return false;
+        }
+        if (!fill()) return false;
+    }
+    if (newline - pos > MAX_LINE_BYTES) {
+        line_too_long = true;
+        return false;
+    }
+    line = buffer.substr(pos, newline - pos);
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    pos = newline + 1;
+    return true;
+}
+
+bool ServerChannel::readBytes(size_t count, std::string& data) {
+    while (buffer.size() - pos < count) {
+        if (!fill()) return false;
+    }
+    data = buffer.substr(pos, count);
+    pos += count;
+    return true;
+}
+
+bool ServerChannel::writeAll(const std::string& data) {
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = ::write(out_fd, data.data() + done, data.size() - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        done += n;
+    }
+    return true;
+}
+
+bool ServerChannel::request(const std::string& header, const std::string& body, ServerReply& reply) {
+    reply = ServerReply();
+    if (!writeAll(header + "\n" + body)) {
+        reply.error = "Cannot send the request";
+        return false;
+    }
+
+    std::string line;
+    if (!readLine(line)) {
+        reply.error = "Connection closed by the server";
+        return false;
+    }
+
+    std::istringstream fields(line);
+    std::string status;
+    fields >> status;
+    if (status == "ERR") {
+        reply.error = line.size() > 4 ? line.substr(4) : "Request failed";
+        return false;
+    }
+
+    // OK <terms> <literals> <optimal> <bytes>
+    int optimal = 0;
+    size_t bytes = 0;
+    if (status != "OK" || !(fields >> reply.product_terms >> reply.literals >> optimal >> bytes)) {
+        reply.error = "Malformed reply: " + line;
+        return false;
+    }
+    if (!readBytes(bytes, reply.pla)) {
+        reply.error = "Connection closed by the server";
+        return false;
+    }
+    reply.proven_optimal = (optimal != 0);
+    reply.ok = true;
+    return true;
+}
+
+int ServerChannel::connectTo(const std::string& socket_path) {
+    struct sockaddr_un address;
+    if (socket_path.size() >= sizeof(address.sun_path)) return -1;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
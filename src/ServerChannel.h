@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// Reply of the minimization server as read by a client
+struct ServerReply {
+    bool ok = false;
+    std::string error;                   // ERR message (or a connection error)
+    int product_terms = 0;
+    int literals = 0;
+    bool proven_optimal = false;
+    std::string pla;                     // Minimized PLA text
+};
+
+// Buffered, framed I/O over a socket or a pair of pipes
+// The messages of the server protocol (see Server.h) are a header line,
+// sometimes followed by a body whose byte count the header gives. The same
+// class is used on both ends: the server reads requests with readLine /
+// readBytes, a client sends them with request().
+class ServerChannel {
+public:
+    // Longest header line (a TT request of 16 inputs is about 32 KiB)
+    static const size_t MAX_LINE_BYTES = 1 << 16;
+
+private:
+    int in_fd;
+    int out_fd;
+    std::string buffer;                  // Bytes read but not consumed yet
+    size_t pos;
+    bool line_too_long;                  // The last readLine found no '\n' in time
+
+    // Read more bytes into the buffer; false at end of input
+    bool fill();
+
+public:
+    ServerChannel(int input_fd, int output_fd);
+
+    // One line without its '\n'; false at end of input or after
+    // MAX_LINE_BYTES without a '\n' (see lineTooLong)
+    bool readLine(std::string& line);
+    bool lineTooLong() const { return line_too_long; }
+
+    // Bytes already read that no readLine / readBytes has consumed
+    bool hasBufferedInput() const { return pos < buffer.size(); }
+
+    // Exactly count bytes; false if the input ends first
+    bool readBytes(size_t count, std::string& data);
+
+    bool writeAll(const std::string& data);
+
+    // Client side: send a request and read an OK or ERR reply
+    bool request(const std::string& header, const std::string& body, ServerReply& reply);
+
+    // Connect to a server's Unix domain socket; -1 on failure
+    static int connectTo(const std::string& socket_path);
+};
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// SHA-256 (FIPS 180-4), used for the keys of the result cache
+// Usage: Sha256 h; h.update(data, size); ...; std::string hex = h.hexDigest();
+class Sha256 {
+private:
+    uint32_t state[8];
+    uint8_t block[64];       // Pending input, less than one block
+    size_t block_size;
+    uint64_t total_bytes;
+
+    void compress(const uint8_t* chunk);
+
+public:
+    Sha256();
+
+    void update(const void* data, size_t size);
+    void update(const std::string& text) { update(text.data(), text.size()); }
+
+    // Finish the hash: 64 lowercase hex digits (the object is used up)
+    std::string hexDigest();
+
+    // Hash of a whole string in one call
+    static std::string hash(const std::string& text);
+};
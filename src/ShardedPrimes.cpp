@@ -0,0 +1,241 @@
+#include "ShardedPrimes.h"
+#include "Console.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Pattern character of split variable j in a shard (base-3 digit: 0, 1, -)
+static char patternChar(int shard, int j) {
+    for (int i = 0; i < j; i++) shard /= 3;
+    return "01-"[shard % 3];
+}
+
+ShardedPrimeGenerator::ShardedPrimeGenerator(int num_variables, int num_worker_processes)
+    : num_vars(num_variables),
+      num_workers(num_worker_processes > 0 ? num_worker_processes : ThreadPool::defaultThreadCount()),
+      split_vars(0), recovered_shards(0) {
+}
+
+std::vector<std::string> ShardedPrimeGenerator::shardPrimes(int num_vars, int split_vars,
+                                                            const std::vector<char>& function,
+                                                            int shard) {
+    int rest = num_vars - split_vars;
+    int rest_size = 1 << rest;
+
+    // Assignments of the split variables that match the pattern
+    std::string pattern;
+    std::vector<int> matching(1, 0);
+    for (int j = 0; j < split_vars; j++) {
+        char c = patternChar(shard, j);
+        pattern += c;
+        int bit = 1 << (split_vars - 1 - j);
+        std::vector<int> next;
+        for (int a : matching) {
+            if (c != '0') next.push_back(a | bit);
+            if (c != '1') next.push_back(a);
+        }
+        matching.swap(next);
+    }
+
+    // G_t: points of the remaining variables inside F for every assignment
+    std::vector<int> g_points;
+    for (int r = 0; r < rest_size; r++) {
+        bool inside = true;
+        for (size_t i = 0; i < matching.size() && inside; i++) {
+            inside = function[(matching[i] << rest) | r] != 0;
+        }
+        if (inside) g_points.push_back(r);
+    }
+    if (g_points.empty()) return std::vector<std::string>();
+
+    QuineMcCluskey qm(rest);
+    qm.findPrimeImplicants(g_points, std::vector<int>());
+
+    // Keep the primes that no freed split variable extends
+    std::vector<std::string> primes;
+    for (const auto& q : qm.getPrimeImplicants()) {
+        bool extends = false;
+        for (int j = 0; j < split_vars && !extends; j++) {
+            if (pattern[j] == '-') continue;
+            int flip = 1 << (split_vars - 1 - j);
+            extends = true;
+            for (size_t i = 0; i < matching.size() && extends; i++) {
+                for (int r : q.minterms) {
+                    if (!function[((matching[i] ^ flip) << rest) | r]) {
+                        extends = false;
+                        break;
+                    }
+                }
+            }
+        }
+        if (!extends) primes.push_back(pattern + q.value);
+    }
+    return primes;
+}
+
+bool ShardedPrimeGenerator::runWorker(const std::string& dir, int num_vars, int split_vars,
+                                      const std::vector<char>& function, int worker, int workers) {
+    int num_shards = 1;
+    for (int j = 0; j < split_vars; j++) num_shards *= 3;
+
+    // Written under a temporary name: the coordinator only sees complete files
+    std::string path = dir + "/primes." + std::to_string(worker);
+    std::ofstream file(path + ".tmp");
+    for (int shard = worker; shard < num_shards; shard += workers) {
+        for (const auto& prime : shardPrimes(num_vars, split_vars, function, shard)) {
+            file << prime << "\n";
+        }
+    }
+    file << "end\n";
+    file.close();
+    return file.good() && std::rename((path + ".tmp").c_str(), path.c_str()) == 0;
+}
+
+bool ShardedPrimeGenerator::readPrimes(const std::string& path, std::vector<std::string>& primes) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line == "end") return true;
+        primes.push_back(line);
+    }
+    return false;
+}
+
+bool ShardedPrimeGenerator::findPrimeImplicants(const std::vector<int>& minterms,
+                                                const std::vector<int>& dont_cares) {
+    prime_implicants.clear();
+    recovered_shards = 0;
+    work_error.clear();
+    error.clear();
+
+    std::vector<char> function(size_t(1) << num_vars, 0);
+    for (const std::vector<int>* points : {&minterms, &dont_cares}) {
+        for (int m : *points) {
+            if (m < 0 || size_t(m) >= function.size()) {
+                error = "Minterm " + std::to_string(m) + " is outside " +
+                        std::to_string(num_vars) + " inputs";
+                return false;
+            }
+            function[m] = 1;
+        }
+    }
+
+    // Enough shards with fixed patterns (the expensive ones) for every worker
+    split_vars = 1;
+    while ((1 << split_vars) < 2 * num_workers && split_vars < std::min(num_vars - 1, 8)) {
+        split_vars++;
+    }
+    if (num_vars < 2) split_vars = 0;
+    int num_shards = 1;
+    for (int j = 0; j < split_vars; j++) num_shards *= 3;
+    int workers = std::min(num_workers, num_shards);
+
+    worker_shards.assign(workers, 0);
+    worker_primes.assign(workers, 0);
+    for (int shard = 0; shard < num_shards; shard++) {
+        worker_shards[shard % workers]++;
+    }
+
+    const char* tmp = std::getenv("TMPDIR");
+    std::string dir_template = std::string(tmp && *tmp ? tmp : "/tmp") + "/minimize-shards.XXXXXX";
+    std::vector<char> dir_name(dir_template.begin(), dir_template.end());
+    dir_name.push_back('\0');
+    std::string dir;
+    if (mkdtemp(dir_name.data())) {
+        dir = dir_name.data();
+    } else {
+        work_error = "cannot create a work directory in " + std::string(tmp && *tmp ? tmp : "/tmp");
+    }
+
+    // Fork the workers; the child process inherits the function
+    std::vector<pid_t> pids(workers, -1);
+    for (int w = 0; w < workers && !dir.empty(); w++) {
+        pids[w] = fork();
+        if (pids[w] == 0) {
+            bool ok = runWorker(dir, num_vars, split_vars, function, w, workers);
+            _exit(ok ? 0 : 1);
+        }
+        if (pids[w] < 0) work_error = "fork failed";
+    }
+
+    std::vector<std::string> primes;
+    for (int w = 0; w < workers; w++) {
+        int status = 0;
+        bool finished = pids[w] > 0 && waitpid(pids[w], &status, 0) == pids[w] &&
+                        WIFEXITED(status) && WEXITSTATUS(status) == 0;
+
+        std::vector<std::string> worker_result;
+        std::string path = dir + "/primes." + std::to_string(w);
+        if (!finished || !readPrimes(path, worker_result)) {
+            // Redo the worker's shards here
+            worker_result.clear();
+            for (int shard = w; shard < num_shards; shard += workers) {
+                std::vector<std::string> shard_result = shardPrimes(num_vars, split_vars, function, shard);
+                worker_result.insert(worker_result.end(), shard_result.begin(), shard_result.end());
+                recovered_shards++;
+            }
+        }
+        if (!dir.empty()) std::remove(path.c_str());
+        worker_primes[w] = worker_result.size();
+        primes.insert(primes.end(), worker_result.begin(), worker_result.end());
+    }
+    if (!dir.empty()) rmdir(dir.c_str());
+
+    // The covering stage works on minterms: list the points of each prime
+    for (const auto& value : primes) {
+        std::vector<int> free_bits;
+        int base = 0;
+        for (int v = 0; v < num_vars; v++) {
+            int bit = num_vars - 1 - v;  // The first character is the MSB
+            if (value[v] == '1') base |= 1 << bit;
+            else if (value[v] == '-') free_bits.push_back(bit);
+        }
+
+        std::set<int> points;
+        for (int mask = 0; mask < (1 << free_bits.size()); mask++) {
+            int m = base;
+            for (size_t b = 0; b < free_bits.size(); b++) {
+                if (mask & (1 << b)) m |= 1 << free_bits[b];
+            }
+            points.insert(m);
+        }
+        prime_implicants.push_back(Implicant(value, points));
+    }
+
+    // QuineMcCluskey's column order: fewer '-' first, then fewer 1's, then
+    // by the minterms covered
+    std::sort(prime_implicants.begin(), prime_implicants.end(),
+              [](const Implicant& a, const Implicant& b) {
+        int dash_a = std::count(a.value.begin(), a.value.end(), '-');
+        int dash_b = std::count(b.value.begin(), b.value.end(), '-');
+        if (dash_a != dash_b) return dash_a < dash_b;
+        int ones_a = std::count(a.value.begin(), a.value.end(), '1');
+        int ones_b = std::count(b.value.begin(), b.value.end(), '1');
+        if (ones_a != ones_b) return ones_a < ones_b;
+        return a.minterms < b.minterms;
+    });
+    return true;
+}
+
+void ShardedPrimeGenerator::printSummary() const {
+    int num_shards = 1;
+    for (int j = 0; j < split_vars; j++) num_shards *= 3;
+    LOG(SUMMARY) << "  ✓ Split on " << split_vars << " variables: " << num_shards
+                 << " shards over " << worker_shards.size() << " worker processes" << std::endl;
+    for (size_t w = 0; w < worker_shards.size(); w++) {
+        LOG(SUMMARY) << "    Worker " << (w + 1) << ": " << worker_shards[w] << " shards, "
+                     << worker_primes[w] << " primes" << std::endl;
+    }
+    if (recovered_shards > 0) {
+        LOG(SUMMARY) << "  ✗ " << recovered_shards << " shards computed by the coordinator"
+                     << (work_error.empty() ? " (worker failed)" : " (" + work_error + ")") << std::endl;
+    }
+    for (size_t i = 0; i < prime_implicants.size(); i++) {
+        LOG(DETAILED) << "   PI" << (i + 1) << ": " << prime_implicants[i].value << std::endl;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "QuineMcCluskey.h"
+#include <string>
+#include <vector>
+
+// Prime implicant generation spread over worker processes
+// The function F = on + dc is split on its first k variables. Every prime
+// of F has a pattern t of 0 / 1 / - on those variables, and its remaining
+// part q is a prime of
+//   G_t = AND of the cofactors F_a over the assignments a matching t
+// that stays a prime when one fixed variable of t is freed (q is not an
+// implicant of G_t with that position turned into '-'). So the 3^k
+// patterns are independent shards: each one runs QuineMcCluskey on n-k
+// variables, which is much less work than one run on n variables.
+//
+// The coordinator forks the worker processes (each takes every P-th shard)
+// and reads their primes back from files in a temporary work directory.
+// Shards of a worker that fails are computed by the coordinator. The merged
+// primes are the same set as QuineMcCluskey's, sorted like its columns.
+class ShardedPrimeGenerator {
+private:
+    int num_vars;
+    int num_workers;
+    int split_vars;                          // k: variables the shards fix
+    std::vector<Implicant> prime_implicants;
+
+    // Statistics for printSummary
+    std::vector<int> worker_shards;
+    std::vector<int> worker_primes;
+    int recovered_shards;                    // Shards redone by the coordinator
+    std::string work_error;                  // Why workers could not run
+    std::string error;                       // Why no primes were generated
+
+    // Primes of F (one flag per point) with pattern shard on the split variables
+    static std::vector<std::string> shardPrimes(int num_vars, int split_vars,
+                                                const std::vector<char>& function, int shard);
+
+    // Worker process body: shards worker, worker + workers, ... into its file
+    static bool runWorker(const std::string& dir, int num_vars, int split_vars,
+                          const std::vector<char>& function, int worker, int workers);
+
+    static bool readPrimes(const std::string& path, std::vector<std::string>& primes);
+
+public:
+    static const int MAX_VARS = 24;          // The coordinator keeps a flag per point
+
+    // num_worker_processes <= 0 uses one per core
+    ShardedPrimeGenerator(int num_variables, int num_worker_processes);
+
+    // Find all prime implicants of the on-set plus the don't cares
+    // False if a minterm is outside the num_vars input space (see getError)
+    bool findPrimeImplicants(const std::vector<int>& minterms,
+                             const std::vector<int>& dont_cares);
+    const std::string& getError() const { return error; }
+
+    // Primes ordered like QuineMcCluskey's columns: fewest '-' first, then
+    // by number of 1's. Each one lists its minterms for the covering stage.
+    const std::vector<Implicant>& getPrimeImplicants() const { return prime_implicants; }
+
+    void printSummary() const;
+};
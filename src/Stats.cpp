@@ -0,0 +1,120 @@
+#include "Stats.h"
+#include <algorithm>
+#include <iomanip>
+
+static thread_local RunStats* thread_stats = nullptr;
+
+// The entry of name in a list kept in order of first use
+template <typename T>
+static T& entry(std::vector<std::pair<std::string, T>>& list, const std::string& name) {
+    for (auto& item : list) {
+        if (item.first == name) return item.second;
+    }
+    list.push_back(std::make_pair(name, T()));
+    return list.back().second;
+}
+
+void RunStats::addTime(const std::string& name, double seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Timer& timer = entry(timers, name);
+    timer.seconds += seconds;
+    timer.max_seconds = std::max(timer.max_seconds, seconds);
+    timer.calls++;
+}
+
+void RunStats::add(const std::string& name, long long delta) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entry(counters, name) += delta;
+}
+
+void RunStats::setMax(const std::string& name, long long value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    long long& counter = entry(counters, name);
+    counter = std::max(counter, value);
+}
+
+void RunStats::append(const std::string& name, long long value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entry(series, name).push_back(value);
+}
+
+void RunStats::writeJsonMembers(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(6);
+
+    out << "\"timers\": {";
+    for (size_t i = 0; i < timers.size(); i++) {
+        const Timer& timer = timers[i].second;
+        out << (i ? ", " : "") << "\"" << timers[i].first << "\": {\"seconds\": " << timer.seconds
+            << ", \"calls\": " << timer.calls << ", \"max_seconds\": " << timer.max_seconds << "}";
+    }
+    out << "}, \"counters\": {";
+    for (size_t i = 0; i < counters.size(); i++) {
+        out << (i ? ", " : "") << "\"" << counters[i].first << "\": " << counters[i].second;
+    }
+    out << "}, \"series\": {";
+    for (size_t i = 0; i < series.size(); i++) {
+        out << (i ? ", " : "") << "\"" << series[i].first << "\": [";
+        for (size_t j = 0; j < series[i].second.size(); j++) {
+            out << (j ? ", " : "") << series[i].second[j];
+        }
+        out << "]";
+    }
+    out << "}";
+    out.flags(flags);
+}
+
+void RunStats::print(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(6);
+
+    out << "\n[Stats] Timers" << std::endl;
+    for (const auto& item : timers) {
+        out << "  " << std::left << std::setw(24) << item.first << std::right
+            << std::setw(12) << item.second.seconds << " s  (" << item.second.calls
+            << (item.second.calls == 1 ? " call" : " calls");
+        if (item.second.calls > 1) out << ", longest " << item.second.max_seconds << " s";
+        out << ")" << std::endl;
+    }
+    out << "[Stats] Counters" << std::endl;
+    for (const auto& item : counters) {
+        out << "  " << std::left << std::setw(24) << item.first << std::right
+            << std::setw(12) << item.second << std::endl;
+    }
+    for (const auto& item : series) {
+        out << "  " << std::left << std::setw(24) << item.first << std::right << " ";
+        for (long long value : item.second) out << " " << value;
+        out << std::endl;
+    }
+    out.flags(flags);
+}
+
+RunStats* activeStats() {
+    return thread_stats;
+}
+
+ScopedStats::ScopedStats(RunStats* stats) : previous(thread_stats) {
+    thread_stats = stats;
+}
+
+ScopedStats::~ScopedStats() {
+    thread_stats = previous;
+}
+
+ScopedTimer::ScopedTimer(const char* timer_name, double* total_seconds)
+    : name(timer_name), seconds(total_seconds), stats(thread_stats), running(false) {
+    if (stats || seconds) {
+        start = std::chrono::steady_clock::now();
+        running = true;
+    }
+}
+
+void ScopedTimer::stop() {
+    if (!running) return;
+    running = false;
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (seconds) *seconds += elapsed;
+    if (stats) stats->addTime(name, elapsed);
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Instrumentation of one minimization run (--stats)
+// The stages time themselves with ScopedTimer and report counters to the
+// RunStats active on the calling thread. Nothing is recorded while none is
+// active, so in a normal run every hook is a thread-local pointer check.
+class RunStats {
+public:
+    struct Timer {
+        double seconds = 0;                  // Total over all calls
+        double max_seconds = 0;              // Longest single call
+        long long calls = 0;
+    };
+
+private:
+    // Components of Petrick's method report from pool threads
+    mutable std::mutex mutex;
+
+    // In order of first use, so the output follows the pipeline
+    std::vector<std::pair<std::string, Timer>> timers;
+    std::vector<std::pair<std::string, long long>> counters;
+    std::vector<std::pair<std::string, std::vector<long long>>> series;
+
+public:
+    // Add one timed call of name
+    void addTime(const std::string& name, double seconds);
+
+    // Add delta to a counter
+    void add(const std::string& name, long long delta);
+
+    // Raise a counter to value if it is lower (peaks)
+    void setMax(const std::string& name, long long value);
+
+    // Append a value to a series (e.g. the size of every QM column)
+    void append(const std::string& name, long long value);
+
+    // The members "timers", "counters" and "series" of a JSON object
+    // (without the braces, so the caller can add its own members)
+    void writeJsonMembers(std::ostream& out) const;
+
+    // Human-readable table
+    void print(std::ostream& out) const;
+};
+
+// Statistics of the calling thread's run, or nullptr when not collecting
+RunStats* activeStats();
+
+// Collect the calling thread's statistics into stats for one scope
+// (nullptr: stop collecting), then restore whatever was active before
+class ScopedStats {
+private:
+    RunStats* previous;
+
+public:
+    explicit ScopedStats(RunStats* stats);
+    ~ScopedStats();
+
+    ScopedStats(const ScopedStats&) = delete;
+    ScopedStats& operator=(const ScopedStats&) = delete;
+};
+
+// Times a scope (or until stop()) as one call of the timer name
+// The time is added to the active RunStats and, if given, to *seconds.
+// name must stay valid until the timer stops.
+class ScopedTimer {
+private:
+    const char* name;
+    double* seconds;
+    RunStats* stats;
+    std::chrono::steady_clock::time_point start;
+    bool running;
+
+public:
+    explicit ScopedTimer(const char* timer_name, double* total_seconds = nullptr);
+    ~ScopedTimer() { stop(); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    // Stop timing; later calls do nothing
+    void stop();
+};
@@ -0,0 +1,129 @@
+#include "SubsumptionIndex.h"
+#include <algorithm>
+#include <climits>
+
+// Constructor: start with an empty root
+SubsumptionIndex::SubsumptionIndex() : num_terms(0) {
+    newNode();
+}
+
+void SubsumptionIndex::clear() {
+    nodes.clear();
+    num_terms = 0;
+    newNode();
+}
+
+int SubsumptionIndex::newNode() {
+    Node node;
+    node.common_sig = ~uint64_t(0);
+    node.min_tail = INT_MAX;
+    node.terminal = false;
+    nodes.push_back(node);
+    return nodes.size() - 1;
+}
+
+// Insert a set as a path of its (already sorted) elements
+void SubsumptionIndex::insert(const std::set<int>& term) {
+    uint64_t sig = 0;
+    for (int x : term) {
+        sig |= signature(x);
+    }
+
+    // Walk down the path, creating nodes as needed
+    std::vector<int> path;
+    int current = 0;
+    path.push_back(current);
+
+    for (int x : term) {
+        std::vector<std::pair<int, int>>& children = nodes[current].children;
+        auto it = std::lower_bound(children.begin(), children.end(),
+                                   std::make_pair(x, INT_MIN));
+
+        if (it != children.end() && it->first == x) {
+            current = it->second;
+        } else {
+            size_t pos = it - children.begin();
+            int child = newNode();  // May reallocate nodes, so re-fetch children below
+            nodes[current].children.insert(nodes[current].children.begin() + pos,
+                                           std::make_pair(x, child));
+            current = child;
+        }
+        path.push_back(current);
+    }
+
+    if (nodes[current].terminal) {
+        return;  // Already stored
+    }
+    nodes[current].terminal = true;
+    num_terms++;
+
+    // Update pruning data along the path
+    int depth = path.size() - 1;
+    for (size_t i = 0; i < path.size(); i++) {
+        Node& node = nodes[path[i]];
+        node.common_sig &= sig;
+        node.min_tail = std::min(node.min_tail, depth - (int)i);
+    }
+}
+
+bool SubsumptionIndex::containsSubsetOf(const std::set<int>& query, bool proper) const {
+    if (num_terms == 0) {
+        return false;
+    }
+
+    std::vector<int> elements(query.begin(), query.end());
+    uint64_t query_sig = 0;
+    for (int x : elements) {
+        query_sig |= signature(x);
+    }
+
+    return search(0, elements, 0, 0, query_sig, proper);
+}
+
+bool SubsumptionIndex::search(int node_idx, const std::vector<int>& query, size_t start,
+                              size_t depth, uint64_t query_sig, bool proper) const {
+    const Node& node = nodes[node_idx];
+
+    // Every set below this node needs some element the query doesn't have
+    if (node.common_sig & ~query_sig) {
+        return false;
+    }
+
+    // Not enough query elements left to complete any stored set
+    size_t max_extra = query.size() - start;
+    if (proper) {
+        // A proper subset must also stay strictly smaller than the query
+        if (depth >= query.size()) {
+            return false;
+        }
+        max_extra = std::min(max_extra, query.size() - depth - 1);
+    }
+    if (node.min_tail == INT_MAX || (size_t)node.min_tail > max_extra) {
+        return false;
+    }
+
+    if (node.terminal) {
+        return true;
+    }
+
+    // Merge-walk the sorted children against the remaining query elements
+    const std::vector<std::pair<int, int>>& children = node.children;
+    size_t c = 0;
+    size_t q = start;
+
+    while (c < children.size() && q < query.size()) {
+        if (children[c].first < query[q]) {
+            c++;
+        } else if (query[q] < children[c].first) {
+            q++;
+        } else {
+            if (search(children[c].second, query, q + 1, depth + 1, query_sig, proper)) {
+                return true;
+            }
+            c++;
+            q++;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+// Index over sets of integers that answers "is any stored set a subset of
+// this query set?" without scanning every stored set.
+//
+// Stored sets are kept in a set-trie: each set is a path of increasing
+// elements from the root, and the node at the end of the path is marked
+// terminal. A subset query only descends into children whose label occurs
+// in the query, so whole branches are skipped at once.
+//
+// Every node also keeps the 64-bit signature bits that all sets below it
+// have in common (sig(x) = 1 << (x % 64)). If those bits are not all in the
+// query's signature, no set in that branch can be a subset of the query:
+//   sig(a) & ~sig(b) != 0  =>  a is not a subset of b
+//
+// Used by Petrick's method for absorption (A + AB = A).
+class SubsumptionIndex {
+public:
+    SubsumptionIndex();
+
+    // Remove all stored sets
+    void clear();
+
+    // Store a set (inserting the same set twice is harmless)
+    void insert(const std::set<int>& term);
+
+    // Check if any stored set is a subset of query
+    // proper = true only accepts stored sets that are strictly smaller
+    bool containsSubsetOf(const std::set<int>& query, bool proper = false) const;
+
+    // Number of distinct sets stored
+    size_t size() const { return num_terms; }
+
+private:
+    struct Node {
+        std::vector<std::pair<int, int>> children; // (element, node index), sorted by element
+        uint64_t common_sig;                       // Signature bits shared by every set in this subtree
+        int min_tail;                              // Fewest extra elements to reach a terminal node
+        bool terminal;                             // Does a stored set end here?
+    };
+
+    std::vector<Node> nodes;   // nodes[0] is the root
+    size_t num_terms;
+
+    // Create a new empty node and return its index
+    int newNode();
+
+    // Recursive subset search starting at query[start]
+    bool search(int node, const std::vector<int>& query, size_t start,
+                size_t depth, uint64_t query_sig, bool proper) const;
+
+    static uint64_t signature(int element) { return uint64_t(1) << (element & 63); }
+};
@@ -0,0 +1,50 @@
+#include "ThreadPool.h"
+
+// Constructor: start the worker threads
+ThreadPool::ThreadPool(int num_threads) : stopping(false) {
+    if (num_threads <= 0) {
+        num_threads = defaultThreadCount();
+    }
+
+    for (int i = 0; i < num_threads; i++) {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+// Destructor: let the workers drain the queue, then join them
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_cv.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+            if (tasks.empty()) {
+                return;  // Stopping and nothing left to do
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+
+        task();
+    }
+}
+
+int ThreadPool::defaultThreadCount() {
+    unsigned int hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Fixed-size pool of worker threads
+// Tasks are queued with submit() and run in FIFO order; the returned future
+// delivers the task's result (or rethrows its exception) on get().
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    bool stopping;
+
+    // Worker loop: take tasks until the pool is destroyed
+    void workerLoop();
+
+public:
+    // Constructor: num_threads <= 0 uses defaultThreadCount()
+    explicit ThreadPool(int num_threads = 0);
+
+    // Destructor: finishes queued tasks, then joins all workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task and get a future for its result
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> submit(F task);
+
+    // Number of worker threads
+    int size() const { return workers.size(); }
+
+    // Number of hardware threads (at least 1)
+    static int defaultThreadCount();
+};
+
+template <typename F>
+std::future<typename std::result_of<F()>::type> ThreadPool::submit(F task) {
+    typedef typename std::result_of<F()>::type Result;
+
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(task);
+    std::future<Result> result = packaged->get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        tasks.push([packaged]() { (*packaged)(); });
+    }
+    queue_cv.notify_one();
+
+    return result;
+}
@@ -1,103 +1,246 @@
 // Boolean Function Minimization (Project 2)
 // This program reads a PLA file and outputs minimized SOP using Quine-McCluskey + Petrick's algorithm
 
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <string>
-#include "PlaParser.h"
-#include "QuineMcCluskey.h"
-#include "Petrick.h"
-#include "PlaWriter.h"
+#include <vector>
+#include "Console.h"
+#include "Minimizer.h"
+#include "Batch.h"
+#include "Server.h"
+#include "ResultCache.h"
+#include "MemTrack.h"
+#include "Stats.h"
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options] <input.pla> <output.pla>" << std::endl;
+    std::cout << "       " << program << " --batch [options] <manifest|directory> <output_dir>" << std::endl;
+    std::cout << "       " << program << " --serve SOCKET [options]" << std::endl;
+    std::cout << "Example: ./minimize pla_files/test1.pla output.pla" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --cover ENGINE  Covering engine: auto (planner picks, default), petrick (exact)," << std::endl;
+    std::cout << "                  greedy (heuristic) or pb (exact, clause-learning pseudo-Boolean solver)" << std::endl;
+    std::cout << "  --engine NAME   Minimizer: qm (exact Quine-McCluskey + covering, default)" << std::endl;
+    std::cout << "                  or espresso (heuristic, works on cubes, for many inputs)" << std::endl;
+    std::cout << "  --primes NAME   Prime generator for qm: auto (planner picks, default), qm (from minterms)," << std::endl;
+    std::cout << "                  consensus (iterated consensus on the input cubes) or sharded" << std::endl;
+    std::cout << "                  (Quine-McCluskey on cofactor shards in worker processes)" << std::endl;
+    std::cout << "  --prime-workers N  Worker processes of --primes sharded (default: all cores)" << std::endl;
+    std::cout << "  --all-optimal   List every minimum cover, fewest literals first" << std::endl;
+    std::cout << "  --threads N     Worker threads for Petrick's method (default: all cores)" << std::endl;
+    std::cout << "  --time-limit S  Stop covering after S seconds, keeping the best cover found" << std::endl;
+    std::cout << "  --memory-limit M  Stop Petrick's expansion before it needs more than M MB" << std::endl;
+    std::cout << "  --cache-dir DIR Reuse results stored in DIR, store new ones there" << std::endl;
+    std::cout << "  --edits FILE    Minimize, then apply the edits in FILE one line at a time" << std::endl;
+    std::cout << "                  (\"on 3 5\", \"dc 9\", \"off 4\"), updating the cover incrementally" << std::endl;
+    std::cout << "  --verify        Read the output back and check it against the input: every on-set" << std::endl;
+    std::cout << "                  minterm covered, no off-set minterm (fails with counterexamples)" << std::endl;
+    std::cout << "  --log-level L   Console output: detailed (every step, default), summary" << std::endl;
+    std::cout << "                  (results of the steps) or quiet (none)" << std::endl;
+    std::cout << "  -q, --quiet     Same as --log-level quiet" << std::endl;
+    std::cout << "  --summary FILE  Append a TSV row with stage times, primes, cover size and peak RSS" << std::endl;
+    std::cout << "  --stats FORMAT  Collect stage timers and counters: json (one line) or text" << std::endl;
+    std::cout << "  --stats-file FILE  Append the --stats output to FILE instead of printing it" << std::endl;
+    std::cout << "  --batch         Minimize every PLA file listed in a manifest (one path per line)" << std::endl;
+    std::cout << "                  or found in a directory; outputs, logs and summary.tsv go to output_dir" << std::endl;
+    std::cout << "  --jobs N        Files minimized at once in batch mode, requests served at once" << std::endl;
+    std::cout << "                  in server mode (default: all cores)" << std::endl;
+    std::cout << "  --serve SOCKET  Run as a server on a Unix domain socket (\"-\": stdin/stdout);" << std::endl;
+    std::cout << "                  see tools/minimize_client and tools/server_bench" << std::endl;
+}
+
+// Split "--name=value" into name and value; "--name" alone leaves value empty
+static void splitOption(const std::string& arg, std::string& name, std::string& value) {
+    size_t eq = arg.find('=');
+    name = arg.substr(0, eq);
+    value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+}
 
 int main(int argc, char* argv[]) {
+    // Parse command line arguments
+    std::vector<std::string> positional;
+    MinimizerOptions options;
+    std::string cache_dir;
+    std::string socket_path;
+    std::string summary_file;
+    std::string stats_format;
+    std::string stats_file;
+    bool batch = false;
+    int num_jobs = 0;
+    bool threads_given = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.size() < 2 || arg[0] != '-') {
+            positional.push_back(arg);
+            continue;
+        }
+
+        std::string name, value;
+        splitOption(arg, name, value);
+
+        // Options with a value accept both "--name=value" and "--name value"
+        bool takes_value = (name == "--threads" || name == "--time-limit" || 
+                            name == "--memory-limit" || name == "--cover" ||
+                            name == "--engine" || name == "--primes" ||
+                            name == "--cache-dir" || name == "--edits" ||
+                            name == "--jobs" || name == "--serve" ||
+                            name == "--prime-workers" || name == "--summary" ||
+                            name == "--stats" || name == "--stats-file" ||
+                            name == "--log-level");
+        if (value.empty() && takes_value && i + 1 < argc) {
+            value = argv[++i];
+        }
+
+        if (name == "--threads") {
+            options.num_threads = std::atoi(value.c_str());
+            threads_given = true;
+        } else if (name == "--all-optimal") {
+            options.list_optimal = true;
+        } else if (name == "--engine") {
+            options.engine = value;
+        } else if (name == "--edits") {
+            options.edits_file = value;
+        } else if (name == "--cache-dir") {
+            cache_dir = value;
+        } else if (name == "--primes") {
+            options.prime_engine = value;
+        } else if (name == "--prime-workers") {
+            options.prime_workers = std::atoi(value.c_str());
+        } else if (name == "--cover") {
+            options.cover_engine = value;
+        } else if (name == "--time-limit") {
+            options.budget.time_limit_seconds = std::atof(value.c_str());
+        } else if (name == "--memory-limit") {
+            options.budget.memory_limit_mb = std::atol(value.c_str());
+        } else if (name == "--verify") {
+            options.verify = true;
+        } else if (name == "-q" || name == "--quiet") {
+            setLogLevel(LogLevel::QUIET);
+        } else if (name == "--log-level") {
+            if (value == "quiet") {
+                setLogLevel(LogLevel::QUIET);
+            } else if (value == "summary") {
+                setLogLevel(LogLevel::SUMMARY);
+            } else if (value == "detailed") {
+                setLogLevel(LogLevel::DETAILED);
+            } else {
+                std::cerr << "Unknown log level: " << value << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (name == "--summary") {
+            summary_file = value;
+        } else if (name == "--stats") {
+            stats_format = value;
+        } else if (name == "--stats-file") {
+            stats_file = value;
+        } else if (name == "--batch") {
+            batch = true;
+        } else if (name == "--serve") {
+            socket_path = value;
+        } else if (name == "--jobs") {
+            num_jobs = std::atoi(value.c_str());
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
     // Check command line arguments
-    if (argc != 3) {
-        std::cout << "Usage: " << argv[0] << " <input.pla> <output.pla>" << std::endl;
-        std::cout << "Example: ./minimize pla_files/test1.pla output.pla" << std::endl;
+    if (positional.size() != (socket_path.empty() ? 2u : 0u)) {
+        printUsage(argv[0]);
         return 1;
     }
 
-    std::string input_pla = argv[1];
-    std::string output_pla = argv[2];
-    
-    std::cout << "====================================" << std::endl;
-    std::cout << "  Boolean Function Minimization" << std::endl;
-    std::cout << "====================================" << std::endl;
-    std::cout << "Input  PLA: " << input_pla << std::endl;
-    std::cout << "Output PLA: " << output_pla << std::endl;
-
-    // Step 1: Parse PLA file
-    PlaParser parser;
-    if (!parser.parse(input_pla)) {
-        std::cerr << "[Error] Failed to parse PLA file." << std::endl;
+    std::string option_error = checkOptions(options);
+    if (!option_error.empty()) {
+        std::cerr << option_error << std::endl;
+        printUsage(argv[0]);
         return 1;
     }
-    std::cout << "\n[Step 1] PLA Parsing" << std::endl;
-    std::cout << "  ✓ Inputs: " << parser.getNumInputs() << std::endl;
-    std::cout << "  ✓ Product terms: " << parser.getProductTerms().size() << std::endl;
-
-    // Step 2: Extract minterms and don't cares
-    std::vector<int> minterms = parser.getMinterms();
-    std::vector<int> dont_cares = parser.getDontCares();
-    
-    std::cout << "\n[Step 2] Minterm Extraction" << std::endl;
-    std::cout << "  ✓ On-set minterms: ";
-    for (size_t i = 0; i < minterms.size(); ++i) {
-        std::cout << "m" << minterms[i];
-        if (i < minterms.size() - 1) std::cout << ", ";
+
+    if (!stats_file.empty() && stats_format.empty()) stats_format = "json";
+    if (!stats_format.empty() && stats_format != "json" && stats_format != "text") {
+        std::cerr << "Unknown statistics format: " << stats_format << std::endl;
+        printUsage(argv[0]);
+        return 1;
     }
-    std::cout << std::endl;
-    
-    std::cout << "  ✓ Don't cares: ";
-    if (dont_cares.empty()) {
-        std::cout << "(none)";
-    } else {
-        for (size_t i = 0; i < dont_cares.size(); ++i) {
-            std::cout << "m" << dont_cares[i];
-            if (i < dont_cares.size() - 1) std::cout << ", ";
-        }
+    if (!stats_format.empty() && (batch || !socket_path.empty())) {
+        std::cerr << "--stats applies to a single PLA file, not --batch or --serve" << std::endl;
+        return 1;
     }
-    std::cout << std::endl;
-
-    // Step 3: Run Quine-McCluskey Algorithm
-    std::cout << "\n[Step 3] Quine-McCluskey Algorithm" << std::endl;
-    
-    QuineMcCluskey qm(parser.getNumInputs());
-    
-    // Print detailed steps
-    qm.printDetailedSteps(minterms, dont_cares);
-    
-    // Find prime implicants
-    qm.findPrimeImplicants(minterms, dont_cares);
-    
-    const auto& prime_implicants = qm.getPrimeImplicants();
-    std::cout << "\n  ✓ Found " << prime_implicants.size() << " Prime Implicants" << std::endl;
-
-    // Step 4: Run Petrick's Algorithm
-    PetrickSolver petrick;
-    petrick.solve(prime_implicants, minterms, dont_cares);
-    petrick.printSolution();
-
-    // Step 5: Write output PLA
-    std::cout << "\n[Step 5] Write Output PLA" << std::endl;
-    
-    PlaWriter writer(parser.getNumInputs(), 
-                     parser.getInputNames(), 
-                     "F");
-    
-    writer.setMinimalCover(petrick.getMinimalCover());
-    
-    if (writer.write(output_pla)) {
-        std::cout << "  ✓ Successfully wrote to " << output_pla << std::endl;
-        std::cout << "  ✓ Product terms: " << writer.getNumProductTerms() << std::endl;
-        std::cout << "  ✓ Total literals: " << writer.getTotalLiterals() << std::endl;
-    } else {
-        std::cerr << "  ✗ Failed to write output file" << std::endl;
+
+    // The edited function is no longer the one in the input file
+    if (options.verify && !options.edits_file.empty()) {
+        std::cerr << "--verify cannot be combined with --edits" << std::endl;
         return 1;
     }
 
-    std::cout << "\n====================================" << std::endl;
-    std::cout << "  Minimization Complete!" << std::endl;
-    std::cout << "====================================" << std::endl;
+    // Result cache: a stored result skips all computation
+    ResultCache cache(cache_dir);
+    if (cache.isEnabled() && !cache.open()) {
+        return 1;
+    }
 
+    if (!socket_path.empty()) {
+        if (!options.edits_file.empty() || options.list_optimal || options.verify || batch) {
+            std::cerr << "--serve cannot be combined with --edits, --all-optimal, --verify or --batch" << std::endl;
+            return 1;
+        }
+
+        // Requests are served in parallel: one thread each unless asked otherwise
+        if (!threads_given) options.num_threads = 1;
+
+        MinimizeServer server(options, num_jobs, cache);
+        return server.run(socket_path);
+    }
+
+    if (batch) {
+        std::vector<std::string> inputs;
+        std::string error;
+        if (!BatchRunner::collectInputs(positional[0], inputs, error)) {
+            std::cerr << "[Error] " << error << std::endl;
+            return 1;
+        }
+
+        // The files already run in parallel: one thread each unless asked otherwise
+        if (!threads_given) options.num_threads = 1;
+
+        BatchRunner runner(options, num_jobs, cache);
+        return runner.run(inputs, positional[1]) == 0 ? 0 : 1;
+    }
+
+    RunStats stats;
+    MinimizeResult result;
+    {
+        ScopedStats collect(stats_format.empty() ? nullptr : &stats);
+        result = minimizePla(options, positional[0], positional[1], cache);
+    }
+    if (!stats_format.empty()) {
+        std::ofstream file;
+        if (!stats_file.empty()) file.open(stats_file, std::ios::app);
+        std::ostream& out = stats_file.empty() ? std::cout : file;
+        if (stats_format == "json") {
+            writeStatsJson(out, positional[0], result, stats);
+        } else {
+            stats.print(out);
+        }
+        if (!out) std::cerr << "[Error] Cannot write " << stats_file << std::endl;
+    }
+    // The memtrack build reports where the heap went (make memtrack)
+    if (MemTrack::enabled() && stats_format != "json") {
+        MemTrack::print(std::cout);
+    }
+    if (!summary_file.empty() && !appendSummary(summary_file, positional[0], result)) {
+        std::cerr << "[Error] Cannot write " << summary_file << std::endl;
+    }
+    if (!result.ok) {
+        std::cerr << "[Error] " << result.error << std::endl;
+        return 1;
+    }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,104 @@
+// Generates src/NpTableData.h: a minimum cover for every NP class of small
+// functions (see NpTable.h), computed with the exact solver of the main
+// program (QuineMcCluskey + PetrickSolver).
+// Usage: gen_np_table <output.h>    (normally run through `make np-table`)
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/NpTable.h"
+#include "../src/QuineMcCluskey.h"
+#include "../src/CoverSolver.h"
+
+// Exact minimum cover of one function; the solvers' console output is dropped
+static std::string solveExactly(int num_vars, uint32_t on, uint32_t dc) {
+    std::vector<int> minterms, dont_cares;
+    for (int m = 0; m < (1 << num_vars); m++) {
+        if (on >> m & 1) minterms.push_back(m);
+        else if (dc >> m & 1) dont_cares.push_back(m);
+    }
+
+    std::ostringstream discard;
+    std::streambuf* console = std::cout.rdbuf(discard.rdbuf());
+
+    QuineMcCluskey qm(num_vars);
+    qm.findPrimeImplicants(minterms, dont_cares);
+
+    std::unique_ptr<CoverSolver> solver = createCoverSolver("petrick");
+    solver->setNumThreads(1);
+    solver->solve(qm.getPrimeImplicants(), minterms, dont_cares);
+    bool optimal = solver->isProvenOptimal();
+    std::vector<Implicant> cover = solver->getMinimalCover();
+
+    std::cout.rdbuf(console);
+    if (!optimal) {
+        std::cerr << "Cover not proven optimal" << std::endl;
+        std::exit(1);
+    }
+
+    std::string cubes;
+    for (const auto& imp : cover) {
+        if (!cubes.empty()) cubes += " ";
+        cubes += imp.value;
+    }
+    return cubes;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <output.h>" << std::endl;
+        return 1;
+    }
+
+    std::ofstream out(argv[1]);
+    if (!out) {
+        std::cerr << "Cannot write " << argv[1] << std::endl;
+        return 1;
+    }
+
+    out << "// Generated by `make np-table` (tools/gen_np_table.cpp) - do not edit\n";
+    out << "// One minimum cover per NP class, in canonical form, sorted by key\n";
+    out << "#pragma once\n";
+    out << "#include \"NpTable.h\"\n\n";
+    out << "constexpr NpTableEntry NP_TABLE[] = {\n";
+
+    // Keys grow with num_vars, then on, then dc, so this loop emits them in order
+    int classes = 0;
+    for (int n = 1; n <= NpTable::MAX_VARS; n++) {
+        uint32_t all = (uint32_t(1) << (1 << n)) - 1;
+        int n_classes = 0;
+
+        for (uint32_t on = 0; on <= all; on++) {
+            // Every subset of the remaining minterms as don't cares
+            uint32_t free_set = (n <= NpTable::MAX_DC_VARS) ? (all & ~on) : 0;
+            std::vector<uint32_t> dcs;
+            for (uint32_t dc = free_set;; dc = (dc - 1) & free_set) {
+                dcs.push_back(dc);
+                if (dc == 0) break;
+            }
+
+            for (auto it = dcs.rbegin(); it != dcs.rend(); ++it) {
+                uint32_t canon_on, canon_dc;
+                NpTable::Transform t;
+                NpTable::canonicalize(n, on, *it, canon_on, canon_dc, t);
+                if (canon_on != on || canon_dc != *it) continue;  // Not the class representative
+
+                out << "    {0x" << std::hex << NpTable::makeKey(n, on, *it) << std::dec
+                    << "ULL, \"" << solveExactly(n, on, *it) << "\"},\n";
+                n_classes++;
+            }
+        }
+
+        std::cerr << n << " inputs: " << n_classes << " classes" << std::endl;
+        classes += n_classes;
+    }
+
+    out << "};\n\n";
+    out << "constexpr int NP_TABLE_SIZE = " << classes << ";\n";
+    return 0;
+}
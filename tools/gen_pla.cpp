@@ -0,0 +1,193 @@
+// Deterministic generator of PLA test functions for the benchmark corpus
+// The same arguments always give the same file (splitmix64, no library
+// distributions), so benchmark runs on different machines compare.
+//
+// Build: make tools/gen_pla
+// Usage: tools/gen_pla random <inputs> <seed> <on%> <dc%>
+//            every point is on with probability on%, else don't care with dc%
+//        tools/gen_pla cubes <inputs> <seed> <on cubes> <dc cubes> <dash%>
+//            random cubes, each position '-' with probability dash%
+//        tools/gen_pla symmetric <inputs> <low> <high>
+//            on where the number of 1's is in [low, high]; 0 < low <= high < inputs
+//            gives a cyclic chart with no essential primes
+//        tools/gen_pla --corpus <dir>
+//            the benchmark corpus of make bench
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// splitmix64: small, fast and identical everywhere
+class Random {
+private:
+    uint64_t state;
+
+public:
+    explicit Random(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // True with probability percent / 100
+    bool chance(int percent) { return int(next() % 100) < percent; }
+};
+
+struct Term {
+    std::string cube;
+    char output;                          // '1' on-set, '-' don't care
+};
+
+static std::string mintermCube(int m, int num_inputs) {
+    std::string cube(num_inputs, '0');
+    for (int i = 0; i < num_inputs; i++) {
+        if ((m >> (num_inputs - 1 - i)) & 1) cube[i] = '1';
+    }
+    return cube;
+}
+
+static std::vector<Term> randomFunction(int num_inputs, uint64_t seed, int on_percent, int dc_percent) {
+    Random random(seed);
+    std::vector<Term> terms;
+    for (int m = 0; m < (1 << num_inputs); m++) {
+        if (random.chance(on_percent)) {
+            terms.push_back({mintermCube(m, num_inputs), '1'});
+        } else if (random.chance(dc_percent)) {
+            terms.push_back({mintermCube(m, num_inputs), '-'});
+        }
+    }
+    return terms;
+}
+
+static std::vector<Term> randomCubes(int num_inputs, uint64_t seed, int on_cubes, int dc_cubes,
+                                     int dash_percent) {
+    Random random(seed);
+    std::vector<Term> terms;
+    for (int i = 0; i < on_cubes + dc_cubes; i++) {
+        std::string cube(num_inputs, '-');
+        for (auto& c : cube) {
+            if (!random.chance(dash_percent)) c = (random.next() & 1) ? '1' : '0';
+        }
+        terms.push_back({cube, i < on_cubes ? '1' : '-'});
+    }
+    return terms;
+}
+
+static std::vector<Term> symmetricFunction(int num_inputs, int low, int high) {
+    std::vector<Term> terms;
+    for (int m = 0; m < (1 << num_inputs); m++) {
+        int ones = __builtin_popcount(m);
+        if (ones >= low && ones <= high) terms.push_back({mintermCube(m, num_inputs), '1'});
+    }
+    return terms;
+}
+
+static bool writePla(std::ostream& file, const std::string& description, int num_inputs,
+                     const std::vector<Term>& terms) {
+    file << "# " << description << "\n";
+    file << ".i " << num_inputs << "\n.o 1\n.ilb";
+    for (int i = 0; i < num_inputs; i++) {
+        file << " x" << i;
+    }
+    file << "\n.ob F\n.p " << terms.size() << "\n";
+    for (const auto& term : terms) {
+        file << term.cube << " " << term.output << "\n";
+    }
+    file << ".e\n";
+    return file.good();
+}
+
+// Build one function from a generator command line; false if malformed
+static bool generate(const std::vector<std::string>& args, int& num_inputs, std::vector<Term>& terms) {
+    std::vector<int> v;
+    for (size_t i = 1; i < args.size(); i++) v.push_back(std::atoi(args[i].c_str()));
+    if (args.empty() || v.empty() || v[0] < 1 || v[0] > 24) return false;
+    num_inputs = v[0];
+
+    if (args[0] == "random" && v.size() == 4) {
+        terms = randomFunction(v[0], v[1], v[2], v[3]);
+    } else if (args[0] == "cubes" && v.size() == 5) {
+        terms = randomCubes(v[0], v[1], v[2], v[3], v[4]);
+    } else if (args[0] == "symmetric" && v.size() == 3) {
+        terms = symmetricFunction(v[0], v[1], v[2]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// The benchmark corpus: name and generator arguments
+static const char* CORPUS[][2] = {
+    {"rand06_sparse",   "random 6 1 30 10"},
+    {"rand08_sparse",   "random 8 2 30 10"},
+    {"rand08_dense",    "random 8 3 50 0"},
+    {"rand09_dc",       "random 9 4 20 30"},
+    {"rand10_sparse",   "random 10 5 30 10"},
+    {"rand10_dense",    "random 10 6 50 0"},
+    {"rand11_dc",       "random 11 7 20 30"},
+    {"rand12_sparse",   "random 12 8 30 10"},
+    {"cubes10_small",   "cubes 10 9 20 4 30"},
+    {"cubes12_large",   "cubes 12 10 24 4 60"},
+    {"cubes14_large",   "cubes 14 11 30 6 60"},
+    {"cubes16_large",   "cubes 16 12 32 6 60"},
+    {"sym05_1_4",       "symmetric 5 1 4"},
+    {"sym06_2_3",       "symmetric 6 2 3"},
+    {"sym07_2_4",       "symmetric 7 2 4"},
+    {"sym08_3_4",       "symmetric 8 3 4"},
+    {"sym09_3_5",       "symmetric 9 3 5"},
+};
+
+static std::vector<std::string> splitWords(const std::string& text) {
+    std::istringstream stream(text);
+    std::vector<std::string> words;
+    std::string word;
+    while (stream >> word) words.push_back(word);
+    return words;
+}
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " random <inputs> <seed> <on%> <dc%>" << std::endl;
+    std::cout << "       " << program << " cubes <inputs> <seed> <on cubes> <dc cubes> <dash%>" << std::endl;
+    std::cout << "       " << program << " symmetric <inputs> <low> <high>" << std::endl;
+    std::cout << "       " << program << " --corpus <dir>" << std::endl;
+    std::cout << "A single function is written to stdout." << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    if (args.size() == 2 && args[0] == "--corpus") {
+        for (const auto& entry : CORPUS) {
+            int num_inputs;
+            std::vector<Term> terms;
+            generate(splitWords(entry[1]), num_inputs, terms);
+            std::string path = args[1] + "/" + entry[0] + ".pla";
+            std::ofstream file(path);
+            if (!writePla(file, std::string("tools/gen_pla ") + entry[1], num_inputs, terms)) {
+                std::cerr << "[Error] Cannot write " << path << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "  ✓ " << sizeof(CORPUS) / sizeof(CORPUS[0]) << " functions in " << args[1]
+                  << std::endl;
+        return 0;
+    }
+
+    int num_inputs;
+    std::vector<Term> terms;
+    if (!generate(args, num_inputs, terms)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string description = "tools/gen_pla";
+    for (const auto& arg : args) description += " " + arg;
+    return writePla(std::cout, description, num_inputs, terms) ? 0 : 1;
+}
@@ -0,0 +1,358 @@
+// Micro-benchmarks of the Quine-McCluskey and Petrick kernels
+// Every kernel runs on synthetic input of a controlled size, built once
+// from a fixed seed. A kernel is run --warmup times untimed, then --reps
+// times; inputs the kernel changes (the used flags of combineGroups, the
+// SOP of simplify) are copied fresh before every run, outside the timing.
+// The median and percentiles of the runs are printed, so a kernel-level
+// regression shows up without the noise of a whole minimization.
+//
+// Build: make microbench (builds and runs it with the defaults)
+// Usage: tools/kernel_bench [--vars N] [--density P] [--terms S] [--clause C]
+//                           [--warmup W] [--reps R] [--seed X]
+//                           [--threads 1,2,4,...] [--only NAME] [--tsv]
+
+#include "../src/Petrick.h"
+#include "../src/QuineMcCluskey.h"
+#include "../src/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+// Access to the private kernels (friend of QuineMcCluskey and PetrickSolver)
+class KernelBench {
+public:
+    static std::vector<std::vector<Implicant>> groupByOnes(QuineMcCluskey& qm,
+                                                           const std::vector<Implicant>& implicants) {
+        return qm.groupByOnes(implicants);
+    }
+
+    static std::vector<Implicant> combineGroups(QuineMcCluskey& qm,
+                                                std::vector<std::vector<Implicant>>& groups) {
+        return qm.combineGroups(groups);
+    }
+
+    static PetrickSOP multiply(const PetrickSolver& solver, const PetrickSOP& sop,
+                               const PetrickTerm& clause, ThreadPool* pool) {
+        return solver.multiply(sop, clause, pool);
+    }
+
+    static void simplify(const PetrickSolver& solver, PetrickSOP& sop) {
+        solver.simplify(sop);
+    }
+};
+
+// splitmix64, as in tools/gen_pla
+class Random {
+private:
+    uint64_t state;
+
+public:
+    explicit Random(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    int below(int n) { return int(next() % n); }
+};
+
+struct Options {
+    int vars = 10;                       // Inputs of the QM function
+    int density = 40;                    // Percent of minterms in the on-set
+    int terms = 4000;                    // Terms of the Petrick SOP
+    int clause = 4;                      // PIs per Petrick clause
+    int warmup = 3;
+    int reps = 25;
+    uint64_t seed = 1;
+    std::vector<int> threads = {1};      // Pool sizes for multiply (1: serial)
+    std::string only;                    // Run only kernels whose name contains this
+    bool tsv = false;
+};
+
+// Keeps the optimizer from dropping kernel results
+static volatile size_t sink = 0;
+
+static double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, size_t(p * (values.size() - 1) + 0.5));
+    return values[index];
+}
+
+// Time body() reps times after warmup untimed runs; setup() runs before
+// every call, outside the timing. Returns seconds per run.
+template <typename Setup, typename Body>
+static std::vector<double> measure(const Options& options, Setup setup, Body body) {
+    for (int i = 0; i < options.warmup; i++) {
+        setup();
+        body();
+    }
+    std::vector<double> samples;
+    for (int i = 0; i < options.reps; i++) {
+        setup();
+        auto start = Clock::now();
+        body();
+        samples.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return samples;
+}
+
+static void printHeader(const Options& options) {
+    if (options.tsv) {
+        std::cout << "kernel\tsize\tops\treps\tmedian_us\tp90_us\tp99_us\tmin_us\tmax_us\tns_per_op"
+                  << std::endl;
+        return;
+    }
+    std::cout << std::left << "  " << std::setw(26) << "kernel" << std::right
+              << std::setw(9) << "size" << std::setw(12) << "median us" << std::setw(11) << "p90 us"
+              << std::setw(11) << "p99 us" << std::setw(11) << "min us" << std::setw(10) << "ns/op"
+              << std::endl;
+}
+
+// One row; ops is the number of kernel calls (or element operations) per run
+static void report(const Options& options, const std::string& kernel, size_t size, size_t ops,
+                   const std::vector<double>& samples) {
+    double median = percentile(samples, 0.50);
+    double ns_per_op = ops > 0 ? median * 1e9 / ops : 0;
+    if (options.tsv) {
+        std::cout << std::fixed << std::setprecision(3) << kernel << "\t" << size << "\t" << ops
+                  << "\t" << samples.size() << "\t" << median * 1e6 << "\t"
+                  << percentile(samples, 0.90) * 1e6 << "\t" << percentile(samples, 0.99) * 1e6
+                  << "\t" << percentile(samples, 0.0) * 1e6 << "\t" << percentile(samples, 1.0) * 1e6
+                  << "\t" << ns_per_op << std::endl;
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(1) << std::left << "  " << std::setw(26) << kernel
+              << std::right << std::setw(9) << size << std::setw(12) << median * 1e6
+              << std::setw(11) << percentile(samples, 0.90) * 1e6
+              << std::setw(11) << percentile(samples, 0.99) * 1e6
+              << std::setw(11) << percentile(samples, 0.0) * 1e6
+              << std::setw(10) << ns_per_op << std::endl;
+}
+
+static bool selected(const Options& options, const std::string& kernel) {
+    return options.only.empty() || kernel.find(options.only) != std::string::npos;
+}
+
+static std::string toBinary(int m, int width) {
+    std::string binary(width, '0');
+    for (int i = 0; i < width; i++) {
+        if ((m >> (width - 1 - i)) & 1) binary[i] = '1';
+    }
+    return binary;
+}
+
+// ==================== Quine-McCluskey kernels ====================
+
+static void benchQuineMcCluskey(const Options& options) {
+    Random random(options.seed);
+    std::vector<int> minterms;
+    std::vector<Implicant> column;
+    for (int m = 0; m < (1 << options.vars); m++) {
+        if (random.below(100) < options.density) {
+            minterms.push_back(m);
+            column.push_back(Implicant(toBinary(m, options.vars), m));
+        }
+    }
+    QuineMcCluskey qm(options.vars);
+    auto groups = KernelBench::groupByOnes(qm, column);
+
+    // The pairs the first column compares: every implicant of group i with
+    // every one of group i + 1
+    std::vector<std::pair<const Implicant*, const Implicant*>> pairs, combining;
+    for (size_t i = 0; i + 1 < groups.size(); i++) {
+        for (const auto& a : groups[i]) {
+            for (const auto& b : groups[i + 1]) {
+                pairs.push_back(std::make_pair(&a, &b));
+                if (a.canCombineWith(b)) combining.push_back(std::make_pair(&a, &b));
+            }
+        }
+    }
+
+    if (selected(options, "canCombineWith")) {
+        auto samples = measure(options, []() {}, [&]() {
+            size_t count = 0;
+            for (const auto& p : pairs) count += p.first->canCombineWith(*p.second);
+            sink += count;
+        });
+        report(options, "canCombineWith", pairs.size(), pairs.size(), samples);
+    }
+
+    if (selected(options, "combineWith")) {
+        auto samples = measure(options, []() {}, [&]() {
+            size_t count = 0;
+            for (const auto& p : combining) count += p.first->combineWith(*p.second).minterms.size();
+            sink += count;
+        });
+        report(options, "combineWith", combining.size(), combining.size(), samples);
+    }
+
+    // combineGroups marks the used flags, so each run gets fresh groups
+    std::vector<std::vector<Implicant>> input_groups = groups, work;
+    for (int col = 1; col <= 2; col++) {
+        std::string kernel = "combineGroups col" + std::to_string(col);
+        size_t size = 0;
+        for (const auto& g : input_groups) size += g.size();
+        if (selected(options, kernel)) {
+            auto samples = measure(options, [&]() { work = input_groups; }, [&]() {
+                sink += KernelBench::combineGroups(qm, work).size();
+            });
+            report(options, kernel, size, size, samples);
+        }
+        work = input_groups;
+        input_groups = KernelBench::groupByOnes(qm, KernelBench::combineGroups(qm, work));
+    }
+
+    qm.findPrimeImplicants(minterms, {});
+    const std::vector<Implicant>& primes = qm.getPrimeImplicants();
+    PrimeImplicantChart chart;
+    if (selected(options, "chart build")) {
+        auto samples = measure(options, []() {}, [&]() {
+            PrimeImplicantChart fresh;
+            fresh.build(primes, minterms, {});
+            sink += fresh.getNumPIs();
+        });
+        report(options, "chart build", primes.size(), primes.size() * minterms.size(), samples);
+    }
+    if (selected(options, "findEssentialPIs")) {
+        chart.build(primes, minterms, {});
+        auto samples = measure(options, []() {}, [&]() {
+            sink += chart.findEssentialPIs().size();
+        });
+        report(options, "findEssentialPIs", primes.size(), primes.size() * minterms.size(), samples);
+    }
+}
+
+// ==================== Petrick kernels ====================
+
+static void benchPetrick(const Options& options) {
+    // A Petrick SOP over 64 PIs: terms of 3 to 6 PIs, absorbed terms removed
+    const int num_pis = 64;
+    Random random(options.seed + 1);
+    PetrickSolver solver;
+    PetrickSOP sop;
+    while (sop.size() < size_t(options.terms)) {
+        PetrickSOP batch;
+        for (int i = 0; i < options.terms; i++) {
+            PetrickTerm term;
+            int size = 3 + random.below(4);
+            while (int(term.size()) < size) term.insert(random.below(num_pis));
+            batch.push_back(term);
+        }
+        sop.insert(sop.end(), batch.begin(), batch.end());
+        KernelBench::simplify(solver, sop);
+    }
+    sop.resize(options.terms);
+    PetrickTerm clause;
+    while (int(clause.size()) < std::min(options.clause, num_pis)) clause.insert(random.below(num_pis));
+
+    for (int threads : options.threads) {
+        std::string kernel = "multiply x" + std::to_string(threads);
+        if (!selected(options, kernel)) continue;
+        ThreadPool pool(threads);
+        ThreadPool* use_pool = threads > 1 ? &pool : nullptr;
+        auto samples = measure(options, []() {}, [&]() {
+            sink += KernelBench::multiply(solver, sop, clause, use_pool).size();
+        });
+        report(options, kernel, sop.size(), sop.size() * clause.size(), samples);
+    }
+
+    if (selected(options, "simplify")) {
+        // The raw products of one multiplication, before absorption
+        PetrickSOP raw, work;
+        for (const auto& term : sop) {
+            for (int pi : clause) {
+                PetrickTerm product = term;
+                product.insert(pi);
+                raw.push_back(product);
+            }
+        }
+        auto samples = measure(options, [&]() { work = raw; }, [&]() {
+            KernelBench::simplify(solver, work);
+            sink += work.size();
+        });
+        report(options, "simplify", raw.size(), raw.size(), samples);
+    }
+}
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--vars N] [--density P] [--terms S] [--clause C]" << std::endl;
+    std::cout << "       " << std::string(std::string(program).size(), ' ')
+              << " [--warmup W] [--reps R] [--seed X]" << std::endl;
+    std::cout << "       " << std::string(std::string(program).size(), ' ')
+              << " [--threads 1,2,4,...] [--only NAME] [--tsv]" << std::endl;
+}
+
+static std::vector<int> parseList(const std::string& text) {
+    std::vector<int> values;
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        int value = std::atoi(item.c_str());
+        if (value > 0) values.push_back(value);
+    }
+    return values;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--vars" && has_value) {
+            options.vars = std::atoi(argv[++i]);
+        } else if (arg == "--density" && has_value) {
+            options.density = std::atoi(argv[++i]);
+        } else if (arg == "--terms" && has_value) {
+            options.terms = std::atoi(argv[++i]);
+        } else if (arg == "--clause" && has_value) {
+            options.clause = std::atoi(argv[++i]);
+        } else if (arg == "--warmup" && has_value) {
+            options.warmup = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--reps" && has_value) {
+            options.reps = std::atoi(argv[++i]);
+        } else if (arg == "--seed" && has_value) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && has_value) {
+            options.threads = parseList(argv[++i]);
+        } else if (arg == "--only" && has_value) {
+            options.only = argv[++i];
+        } else if (arg == "--tsv") {
+            options.tsv = true;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.vars < 2 || options.vars > 16 || options.terms < 1 || options.clause < 1 ||
+        options.reps < 1 || options.threads.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (!options.tsv) {
+        std::cout << "====================================" << std::endl;
+        std::cout << "  Kernel Micro-Benchmarks" << std::endl;
+        std::cout << "====================================" << std::endl;
+        std::cout << "QM: " << options.vars << " inputs, " << options.density << "% on-set; "
+                  << "Petrick: " << options.terms << " terms, clause of " << options.clause
+                  << "; seed " << options.seed << std::endl;
+        std::cout << "Warmup " << options.warmup << ", repetitions " << options.reps
+                  << " (size: items of the input; ns/op: median / items)" << std::endl << std::endl;
+    }
+    printHeader(options);
+    benchQuineMcCluskey(options);
+    benchPetrick(options);
+    return 0;
+}
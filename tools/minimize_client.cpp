@@ -0,0 +1,129 @@
+// Client of the minimization server (minimize --serve SOCKET)
+// Sends PLA files or truth tables to a running server and prints or saves
+// the minimized PLA text.
+//
+// Build: make tools
+// Usage: tools/minimize_client SOCKET [-o DIR] <file.pla>...
+//        tools/minimize_client SOCKET --tt <inputs> <on-hex> [<dc-hex>]
+//        tools/minimize_client SOCKET --stats | --shutdown
+
+#include "../src/ServerChannel.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " SOCKET [-o DIR] <file.pla>..." << std::endl;
+    std::cout << "       " << program << " SOCKET --tt <inputs> <on-hex> [<dc-hex>]" << std::endl;
+    std::cout << "       " << program << " SOCKET --stats | --shutdown" << std::endl;
+    std::cout << "Without -o, the minimized PLA is printed; with -o DIR it is written" << std::endl;
+    std::cout << "to DIR/<name>.pla and one line per file is printed." << std::endl;
+}
+
+static bool readFile(const std::string& path, std::string& text) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    text = contents.str();
+    return true;
+}
+
+// "dir/test1.pla" -> "test1.pla"
+static std::string baseName(const std::string& path) {
+    size_t slash = path.find_last_of('/');
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string socket_path = argv[1];
+    int fd = ServerChannel::connectTo(socket_path);
+    if (fd < 0) {
+        std::cerr << "[Error] Cannot connect to " << socket_path << std::endl;
+        return 1;
+    }
+    ServerChannel channel(fd, fd);
+
+    std::string first = argv[2];
+    if (first == "--stats" || first == "--shutdown") {
+        std::string line;
+        if (!channel.writeAll(first == "--stats" ? "STATS\n" : "SHUTDOWN\n") ||
+            !channel.readLine(line)) {
+            std::cerr << "[Error] No reply from the server" << std::endl;
+            close(fd);
+            return 1;
+        }
+        std::cout << line << std::endl;
+        close(fd);
+        return 0;
+    }
+
+    if (first == "--tt") {
+        std::string header = "TT";
+        for (int i = 3; i < argc; i++) {
+            header += std::string(" ") + argv[i];
+        }
+        ServerReply reply;
+        if (!channel.request(header, "", reply)) {
+            std::cerr << "[Error] " << reply.error << std::endl;
+            close(fd);
+            return 1;
+        }
+        std::cout << reply.pla;
+        close(fd);
+        return 0;
+    }
+
+    std::string output_dir;
+    std::vector<std::string> files;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            output_dir = argv[++i];
+        } else {
+            files.push_back(arg);
+        }
+    }
+
+    int failed = 0;
+    for (const auto& path : files) {
+        std::string text;
+        ServerReply reply;
+        if (!readFile(path, text)) {
+            reply.error = "Cannot read " + path;
+        } else {
+            channel.request("PLA " + std::to_string(text.size()), text, reply);
+        }
+
+        if (!reply.ok) {
+            std::cerr << "  ✗ " << path << ": " << reply.error << std::endl;
+            failed++;
+            continue;
+        }
+        if (output_dir.empty()) {
+            std::cout << reply.pla;
+            continue;
+        }
+
+        std::string output = output_dir + "/" + baseName(path);
+        std::ofstream file(output);
+        if (!(file << reply.pla)) {
+            std::cerr << "  ✗ " << path << ": Cannot write " << output << std::endl;
+            failed++;
+            continue;
+        }
+        std::cout << "  ✓ " << path << ": " << reply.product_terms << " terms, "
+                  << reply.literals << " literals -> " << output << std::endl;
+    }
+
+    close(fd);
+    return failed == 0 ? 0 : 1;
+}
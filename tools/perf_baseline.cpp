@@ -0,0 +1,408 @@
+// Performance regression baseline of the benchmark corpus
+// Every case of the baseline file is minimized several times, each run in
+// its own minimize process (--summary gives its time, peak RSS and cover).
+// "record" stores the median time, median peak RSS and the cover cost of
+// every case in the baseline file; "check" compares a new run with it and
+// fails on a slowdown or memory growth beyond the tolerances, and on any
+// change of the cover cost (better or worse: the baseline must then be
+// recorded again deliberately).
+//
+// The baseline file is TSV. Its case and options columns define the suite
+// (a new case is added as a row with "-" in the measured columns); record
+// fills in the rest. The inputs are the functions of tools/gen_pla --corpus,
+// whose hashes are stored so a changed generator is noticed.
+//
+// Build: make tools (run through make perf-record / make perf-check)
+// Usage: tools/perf_baseline record|check [options] BASELINE CORPUS_DIR
+
+#include "../src/Sha256.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// One row of the baseline file
+struct BaselineCase {
+    std::string name;                    // Corpus file without ".pla"
+    std::string options;                 // Extra minimize options ("-": none)
+    std::string input_hash;              // First 16 hex digits of the input's SHA-256
+    int terms = -1;                      // -1: not recorded yet
+    int literals = -1;
+    double median_seconds = -1;
+    long peak_rss_kb = -1;
+};
+
+// Medians over the runs of one case
+struct Measurement {
+    bool ok = false;
+    std::string error;
+    std::string input_hash;
+    int terms = 0;
+    int literals = 0;
+    double median_seconds = 0;
+    long peak_rss_kb = 0;
+};
+
+struct Settings {
+    std::string minimize = "./minimize";
+    std::string work_dir = "bench_output/perf";
+    int runs = 5;
+    double time_tolerance = 25;          // Percent
+    double memory_tolerance = 10;        // Percent
+    double min_time_change = 0.010;      // Seconds; smaller differences are noise
+};
+
+static const char* HEADER = "case\toptions\tinput_sha256\tterms\tliterals\tmedian_s\tpeak_rss_kb";
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " record|check [options] BASELINE CORPUS_DIR" << std::endl;
+    std::cout << "  record                  Measure every case of BASELINE and store the results in it" << std::endl;
+    std::cout << "  check                   Measure again and compare; exit status 1 on a regression" << std::endl;
+    std::cout << "  --runs N                Measured runs per case, after one warm-up run (default 5)" << std::endl;
+    std::cout << "  --minimize BINARY       Program to measure (default ./minimize)" << std::endl;
+    std::cout << "  --work DIR              Outputs and summaries of the runs (default bench_output/perf)" << std::endl;
+    std::cout << "  --time-tolerance P      Allowed slowdown of the median time in percent (default 25)" << std::endl;
+    std::cout << "  --memory-tolerance P    Allowed growth of the peak RSS in percent (default 10)" << std::endl;
+    std::cout << "  --min-time S            Ignore time differences below S seconds (default 0.010)" << std::endl;
+}
+
+static std::vector<std::string> split(const std::string& text, char separator) {
+    std::vector<std::string> fields;
+    std::istringstream stream(text);
+    std::string field;
+    while (std::getline(stream, field, separator)) fields.push_back(field);
+    return fields;
+}
+
+static std::vector<std::string> splitWords(const std::string& text) {
+    std::istringstream stream(text);
+    std::vector<std::string> words;
+    std::string word;
+    while (stream >> word) words.push_back(word);
+    return words;
+}
+
+static bool readFile(const std::string& path, std::string& text) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    text = contents.str();
+    return true;
+}
+
+static double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+// "name, CPU model, N cores": times only compare on the same machine
+static std::string hostDescription() {
+    char name[256] = "unknown";
+    gethostname(name, sizeof(name) - 1);
+    std::string cpu = "unknown CPU";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) cpu = line.substr(line.find_first_not_of(" ", colon + 1));
+            break;
+        }
+    }
+    std::ostringstream text;
+    text << name << ", " << cpu << ", " << std::thread::hardware_concurrency() << " cores";
+    return text.str();
+}
+
+static bool readBaseline(const std::string& path, std::vector<BaselineCase>& cases,
+                         std::string& host, std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line)) {
+        line_number++;
+        if (line.compare(0, 8, "# host: ") == 0) host = line.substr(8);
+        if (line.empty() || line[0] == '#' || line == HEADER) continue;
+
+        std::vector<std::string> fields = split(line, '\t');
+        if (fields.size() != 7) {
+            error = path + ":" + std::to_string(line_number) + ": expected 7 tab-separated fields";
+            return false;
+        }
+        BaselineCase c;
+        c.name = fields[0];
+        c.options = fields[1];
+        c.input_hash = fields[2];
+        if (fields[3] != "-") {
+            c.terms = std::atoi(fields[3].c_str());
+            c.literals = std::atoi(fields[4].c_str());
+            c.median_seconds = std::atof(fields[5].c_str());
+            c.peak_rss_kb = std::atol(fields[6].c_str());
+        }
+        cases.push_back(c);
+    }
+    if (cases.empty()) {
+        error = path + " lists no cases";
+        return false;
+    }
+    return true;
+}
+
+static bool writeBaseline(const std::string& path, const std::vector<BaselineCase>& cases,
+                          int runs) {
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%d", localtime(&now));
+
+    std::ofstream file(path);
+    if (!file.is_open()) return false;
+    file << "# Performance baseline of the benchmark corpus (make perf-record, make perf-check)\n";
+    file << "# Median of " << runs << " runs per case, recorded " << date << "\n";
+    file << "# host: " << hostDescription() << "\n";
+    file << HEADER << "\n";
+    for (const auto& c : cases) {
+        file << c.name << "\t" << c.options << "\t" << c.input_hash << "\t" << c.terms << "\t"
+             << c.literals << "\t" << std::fixed << std::setprecision(6) << c.median_seconds
+             << "\t" << c.peak_rss_kb << "\n";
+    }
+    return file.good();
+}
+
+// Run minimize with its output discarded; true if it exited with status 0
+static bool runMinimize(const std::vector<std::string>& args) {
+    std::vector<char*> argv;
+    for (const auto& arg : args) argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        execv(argv[0], argv.data());
+        _exit(127);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// Run one case runs + 1 times (the first warms the page cache) and take the
+// medians; the cover must be the same every time
+static Measurement measure(const Settings& settings, const std::string& corpus_dir,
+                           const BaselineCase& c) {
+    Measurement m;
+    std::string input = corpus_dir + "/" + c.name + ".pla";
+    std::string text;
+    if (!readFile(input, text)) {
+        m.error = "cannot read " + input;
+        return m;
+    }
+    m.input_hash = Sha256::hash(text).substr(0, 16);
+
+    std::string summary = settings.work_dir + "/" + c.name + ".tsv";
+    std::vector<std::string> args = {settings.minimize, "-q", "--summary", summary};
+    if (c.options != "-") {
+        for (const auto& word : splitWords(c.options)) args.push_back(word);
+    }
+    args.push_back(input);
+    args.push_back(settings.work_dir + "/" + c.name + ".pla");
+
+    std::vector<double> seconds, rss_kb;
+    for (int run = 0; run <= settings.runs; run++) {
+        std::remove(summary.c_str());
+        bool exited = runMinimize(args);
+
+        // The summary row: file status inputs primes terms literals optimal
+        // parse_s primes_s cover_s write_s total_s peak_rss_kb
+        std::ifstream file(summary);
+        std::string line, row;
+        while (std::getline(file, line)) row = line;
+        std::vector<std::string> fields = split(row, '\t');
+        if (!exited || fields.size() != 13 || fields[1] != "ok") {
+            m.error = "minimize failed";
+            return m;
+        }
+        int terms = std::atoi(fields[4].c_str()), literals = std::atoi(fields[5].c_str());
+        if (run > 1 && (terms != m.terms || literals != m.literals)) {
+            m.error = "cover differs between runs (options not deterministic?)";
+            return m;
+        }
+        m.terms = terms;
+        m.literals = literals;
+        if (run == 0) continue;
+        seconds.push_back(std::atof(fields[11].c_str()));
+        rss_kb.push_back(std::atof(fields[12].c_str()));
+    }
+    m.median_seconds = median(seconds);
+    m.peak_rss_kb = long(median(rss_kb));
+    m.ok = true;
+    return m;
+}
+
+static std::string percentChange(double value, double base) {
+    std::ostringstream text;
+    text << std::showpos << std::fixed << std::setprecision(1)
+         << (base > 0 ? (value - base) / base * 100 : 0) << "%";
+    return text.str();
+}
+
+static int record(const Settings& settings, const std::string& baseline_path,
+                  const std::string& corpus_dir, std::vector<BaselineCase>& cases) {
+    std::cout << "[Baseline] Recording " << cases.size() << " cases, " << settings.runs
+              << " runs each" << std::endl;
+    int failed = 0;
+    for (auto& c : cases) {
+        Measurement m = measure(settings, corpus_dir, c);
+        if (!m.ok) {
+            std::cout << "  ✗ " << c.name << ": " << m.error << std::endl;
+            failed++;
+            continue;
+        }
+        c.input_hash = m.input_hash;
+        c.terms = m.terms;
+        c.literals = m.literals;
+        c.median_seconds = m.median_seconds;
+        c.peak_rss_kb = m.peak_rss_kb;
+        std::cout << "  ✓ " << std::left << std::setw(18) << c.name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << m.median_seconds * 1000 << " ms"
+                  << std::setw(10) << m.peak_rss_kb << " KB   " << m.terms << " terms, "
+                  << m.literals << " literals" << std::endl;
+    }
+    if (failed > 0) {
+        std::cout << "  ✗ " << failed << " cases failed; " << baseline_path << " left unchanged" << std::endl;
+        return 1;
+    }
+    if (!writeBaseline(baseline_path, cases, settings.runs)) {
+        std::cerr << "[Error] Cannot write " << baseline_path << std::endl;
+        return 2;
+    }
+    std::cout << "  ✓ Baseline written to " << baseline_path << std::endl;
+    return 0;
+}
+
+static int check(const Settings& settings, const std::string& baseline_path,
+                 const std::string& corpus_dir, const std::vector<BaselineCase>& cases,
+                 const std::string& baseline_host) {
+    std::cout << "[Baseline] Checking " << cases.size() << " cases against " << baseline_path
+              << " (" << settings.runs << " runs each; tolerances: time " << settings.time_tolerance
+              << "%, memory " << settings.memory_tolerance << "%)" << std::endl;
+    std::string host = hostDescription();
+    if (baseline_host != host) {
+        std::cout << "  ⚠ Recorded on " << (baseline_host.empty() ? "an unknown host" : baseline_host)
+                  << ", running on " << host << ": times may not compare" << std::endl;
+    }
+    std::cout << "    " << std::left << std::setw(18) << "case" << std::right << std::setw(11)
+              << "median ms" << std::setw(11) << "base ms" << std::setw(9) << "change"
+              << std::setw(10) << "peak KB" << std::setw(10) << "base KB" << std::setw(9)
+              << "change" << "   terms/literals" << std::endl;
+
+    int slower = 0, larger = 0, cost_changes = 0, failed = 0, faster = 0;
+    for (const auto& c : cases) {
+        Measurement m = measure(settings, corpus_dir, c);
+        if (!m.ok || c.terms < 0 || m.input_hash != c.input_hash) {
+            std::string why = !m.ok ? m.error : c.terms < 0 ? "not recorded yet (make perf-record)"
+                                              : "input changed since the baseline was recorded";
+            std::cout << "  ✗ " << std::left << std::setw(18) << c.name << std::right << why << std::endl;
+            failed++;
+            continue;
+        }
+
+        double time_change = m.median_seconds - c.median_seconds;
+        bool is_slower = m.median_seconds > c.median_seconds * (1 + settings.time_tolerance / 100) &&
+                         time_change > settings.min_time_change;
+        bool is_faster = m.median_seconds < c.median_seconds * (1 - settings.time_tolerance / 100) &&
+                         -time_change > settings.min_time_change;
+        bool is_larger = m.peak_rss_kb > c.peak_rss_kb * (1 + settings.memory_tolerance / 100);
+        bool cost_changed = m.terms != c.terms || m.literals != c.literals;
+        slower += is_slower;
+        faster += is_faster;
+        larger += is_larger;
+        cost_changes += cost_changed;
+
+        bool regressed = is_slower || is_larger || cost_changed;
+        std::cout << "  " << (regressed ? "✗" : "✓") << " " << std::left << std::setw(18) << c.name
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(11) << m.median_seconds * 1000 << std::setw(11) << c.median_seconds * 1000
+                  << std::setw(9) << percentChange(m.median_seconds, c.median_seconds)
+                  << std::setw(10) << m.peak_rss_kb << std::setw(10) << c.peak_rss_kb
+                  << std::setw(9) << percentChange(m.peak_rss_kb, c.peak_rss_kb)
+                  << "   " << m.terms << "/" << m.literals;
+        if (cost_changed) std::cout << " (was " << c.terms << "/" << c.literals << ")";
+        if (is_slower) std::cout << "  slower";
+        if (is_larger) std::cout << "  more memory";
+        if (is_faster) std::cout << "  faster";
+        std::cout << std::endl;
+    }
+
+    std::cout << "\n[Summary] " << slower << " slower, " << larger << " using more memory, "
+              << cost_changes << " cover cost changes, " << failed << " failed" << std::endl;
+    if (faster > 0) {
+        std::cout << "  " << faster << (faster == 1 ? " case" : " cases")
+                  << " got faster: make perf-record keeps the gain" << std::endl;
+    }
+    bool passed = slower + larger + cost_changes + failed == 0;
+    std::cout << "  " << (passed ? "✓ No regressions" : "✗ Regressions against the baseline") << std::endl;
+    return passed ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    Settings settings;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--runs" && has_value) {
+            settings.runs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--minimize" && has_value) {
+            settings.minimize = argv[++i];
+        } else if (arg == "--work" && has_value) {
+            settings.work_dir = argv[++i];
+        } else if (arg == "--time-tolerance" && has_value) {
+            settings.time_tolerance = std::atof(argv[++i]);
+        } else if (arg == "--memory-tolerance" && has_value) {
+            settings.memory_tolerance = std::atof(argv[++i]);
+        } else if (arg == "--min-time" && has_value) {
+            settings.min_time_change = std::atof(argv[++i]);
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            printUsage(argv[0]);
+            return 2;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+    if (positional.size() != 3 || (positional[0] != "record" && positional[0] != "check")) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<BaselineCase> cases;
+    std::string host, error;
+    if (!readBaseline(positional[1], cases, host, error)) {
+        std::cerr << "[Error] " << error << std::endl;
+        return 2;
+    }
+    mkdir(settings.work_dir.c_str(), 0755);
+
+    if (positional[0] == "record") return record(settings, positional[1], positional[2], cases);
+    return check(settings, positional[1], positional[2], cases, host);
+}
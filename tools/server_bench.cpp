@@ -0,0 +1,189 @@
+// Throughput benchmark of the minimization server (minimize --serve SOCKET)
+// Several client threads, one connection each, send the given PLA files
+// round-robin and time every request. Each request gets a distinct comment
+// line so the server's reply memo does not answer it (--warm sends the
+// files unchanged). With --spawn BINARY the same requests are also run as
+// one BINARY process per file, for comparison.
+//
+// Build: make tools
+// Usage: tools/server_bench SOCKET [--clients C] [--requests R] [--warm]
+//                           [--spawn ./minimize] <file.pla>...
+
+#include "../src/ServerChannel.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+struct RunStats {
+    std::vector<double> latencies;       // Seconds, one per request
+    int failed = 0;
+    double seconds = 0;                  // Wall time of the whole run
+};
+
+static void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " SOCKET [--clients C] [--requests R] [--warm]" << std::endl;
+    std::cout << "       " << std::string(std::string(program).size(), ' ')
+              << " [--spawn BINARY] <file.pla>..." << std::endl;
+}
+
+static double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, size_t(p * (values.size() - 1) + 0.5));
+    return values[index];
+}
+
+static void report(const std::string& name, const RunStats& stats) {
+    size_t done = stats.latencies.size();
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  " << std::left << std::setw(8) << name << std::right
+              << std::setw(9) << (stats.seconds > 0 ? done / stats.seconds : 0) << " req/s"
+              << "   p50 " << percentile(stats.latencies, 0.50) * 1000 << " ms"
+              << "   p90 " << percentile(stats.latencies, 0.90) * 1000 << " ms"
+              << "   p99 " << percentile(stats.latencies, 0.99) * 1000 << " ms";
+    if (stats.failed > 0) std::cout << "   (" << stats.failed << " failed)";
+    std::cout << std::endl;
+}
+
+// Run total requests on num_clients threads; request(client, k) does request k
+template <typename F>
+static RunStats runClients(int num_clients, int total, F request) {
+    RunStats stats;
+    std::vector<std::vector<double>> latencies(num_clients);
+    std::atomic<int> next(0), failed(0);
+
+    auto start = Clock::now();
+    std::vector<std::thread> clients;
+    for (int c = 0; c < num_clients; c++) {
+        clients.push_back(std::thread([&, c]() {
+            int k;
+            while ((k = next++) < total) {
+                auto begin = Clock::now();
+                if (request(c, k)) {
+                    latencies[c].push_back(std::chrono::duration<double>(Clock::now() - begin).count());
+                } else {
+                    failed++;
+                }
+            }
+        }));
+    }
+    for (auto& t : clients) t.join();
+    stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (const auto& l : latencies) {
+        stats.latencies.insert(stats.latencies.end(), l.begin(), l.end());
+    }
+    stats.failed = failed;
+    return stats;
+}
+
+// One minimize process per request, output discarded
+static bool spawnRun(const std::string& binary, const std::string& input) {
+    pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        execl(binary.c_str(), binary.c_str(), input.c_str(), "/dev/null", (char*)nullptr);
+        _exit(127);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    std::string socket_path;
+    std::string spawn_binary;
+    int num_clients = 4;
+    int total = 200;
+    bool warm = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--clients" && i + 1 < argc) {
+            num_clients = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--requests" && i + 1 < argc) {
+            total = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--spawn" && i + 1 < argc) {
+            spawn_binary = argv[++i];
+        } else if (arg == "--warm") {
+            warm = true;
+        } else if (socket_path.empty()) {
+            socket_path = arg;
+        } else {
+            files.push_back(arg);
+        }
+    }
+    if (socket_path.empty() || files.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> texts;
+    for (const auto& path : files) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            std::cerr << "[Error] Cannot read " << path << std::endl;
+            return 1;
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        texts.push_back(contents.str());
+    }
+
+    std::vector<int> fds(num_clients);
+    for (int c = 0; c < num_clients; c++) {
+        fds[c] = ServerChannel::connectTo(socket_path);
+        if (fds[c] < 0) {
+            std::cerr << "[Error] Cannot connect to " << socket_path << std::endl;
+            return 1;
+        }
+    }
+    std::vector<ServerChannel> channels;
+    for (int fd : fds) channels.push_back(ServerChannel(fd, fd));
+
+    std::cout << "====================================" << std::endl;
+    std::cout << "  Server Throughput Benchmark" << std::endl;
+    std::cout << "====================================" << std::endl;
+    std::cout << "Requests: " << total << " over " << files.size() << " files, "
+              << num_clients << " clients, " << (warm ? "repeated (warm)" : "distinct (cold)")
+              << std::endl << std::endl;
+
+    RunStats server = runClients(num_clients, total, [&](int c, int k) {
+        std::string text = texts[k % texts.size()];
+        if (!warm) text = "# request " + std::to_string(k) + "\n" + text;
+        ServerReply reply;
+        return channels[c].request("PLA " + std::to_string(text.size()), text, reply);
+    });
+    report("server", server);
+
+    if (!spawn_binary.empty()) {
+        RunStats spawn = runClients(num_clients, total, [&](int, int k) {
+            return spawnRun(spawn_binary, files[k % files.size()]);
+        });
+        report("spawn", spawn);
+        if (server.seconds > 0 && spawn.seconds > 0) {
+            std::cout << "  Speedup of the server: " << std::setprecision(2)
+                      << spawn.seconds / server.seconds << "x" << std::endl;
+        }
+    }
+
+    for (int fd : fds) close(fd);
+    return server.failed == 0 ? 0 : 1;
+}